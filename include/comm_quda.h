@@ -23,6 +23,7 @@ namespace quda
 {
 
   typedef struct MsgHandle_s MsgHandle;
+  typedef struct ReduceHandle_s ReduceHandle;
   typedef struct Topology_s Topology;
 
   char *comm_hostname(void);
@@ -403,6 +404,37 @@ namespace quda
   int comm_query(MsgHandle *mh);
 
   template <typename T> void comm_allreduce_sum(T &v);
+
+  /**
+     @brief Sum an array of doubles in place across all processes
+     @param[in,out] data The array to be summed
+     @param[in] size Number of elements in the array
+  */
+  void comm_allreduce_sum_array(double *data, size_t size);
+
+  /**
+     @brief Start a non-blocking sum of an array of doubles in place
+     across all processes.  The array must not be accessed until the
+     reduction has been completed with comm_allreduce_wait.
+     @param[in,out] data The array to be summed
+     @param[in] size Number of elements in the array
+     @return Handle to the in-flight reduction
+  */
+  ReduceHandle *comm_allreduce_sum_array_start(double *data, size_t size);
+
+  /**
+     @brief Query whether a non-blocking reduction has completed
+     @param[in] rh Handle to the in-flight reduction
+     @return Whether the reduction has completed
+  */
+  bool comm_allreduce_test(ReduceHandle *rh);
+
+  /**
+     @brief Complete a non-blocking reduction and free its handle
+     @param[in,out] rh Handle to the in-flight reduction, set to nullptr on return
+  */
+  void comm_allreduce_wait(ReduceHandle *&rh);
+
   template <typename T> void comm_allreduce_max(T &v);
   template <typename T> void comm_allreduce_min(T &v);
 
@@ -3,6 +3,7 @@
 #include <unistd.h> // for gethostname()
 #include <cassert>
 #include <csignal>
+#include <cmath>
 #include <limits>
 #include <stack>
 #include <algorithm>
@@ -143,6 +144,63 @@ namespace quda
     }
   }
 
+  /**
+     log2 of the largest number of partials the deterministic reduction
+     may combine.  The binning grid depends only on this bound and the
+     global maximum, not on the rank count, so the reduced value of a
+     given set of partials is the same on any number of ranks.
+   */
+  constexpr int binned_max_terms_log2 = 20;
+
+  /**
+     Number of pre-rounded components each value is split into for
+     the deterministic reduction.  Each fold captures 52 -
+     binned_max_terms_log2 bits, so three folds exceed double
+     precision relative to the global maximum.
+   */
+  constexpr int binned_folds = 3;
+
+  /**
+     @brief Split each local partial into binned_folds components that
+     are pre-rounded to a grid set by the global maximum magnitude.
+     Summing the components of up to 2^binned_max_terms_log2 partials
+     is then exact, and so bitwise reproducible regardless of the
+     order or grouping in which they are combined.
+     @param[out] bins Components, binned_folds per element
+     @param[in] data Local partials
+     @param[in] max Global maximum magnitude of each element
+     @param[in] size Number of elements
+   */
+  inline void binned_split(double *bins, const double *data, const double *max, size_t size)
+  {
+    constexpr int lg = binned_max_terms_log2;
+    for (size_t i = 0; i < size; i++) {
+      double r = data[i];
+      int e;
+      std::frexp(max[i], &e); // |data| <= max < 2^e on every rank
+      for (int k = 0; k < binned_folds; k++) {
+        double sigma = std::ldexp(1.0, e + lg + 1);
+        double q = (sigma + r) - sigma; // r rounded to the grid of sigma, r - q is exact
+        bins[i * binned_folds + k] = q;
+        r -= q;
+        e += lg - 52;
+      }
+    }
+  }
+
+  /**
+     @brief Recombine the reduced components of an element, smallest
+     first.  The components are identical on all ranks, so the result is too.
+     @param[in] bins Reduced components of a single element
+     @return The sum of the components
+   */
+  inline double binned_sum(const double *bins)
+  {
+    double sum = 0.0;
+    for (int k = binned_folds - 1; k >= 0; k--) sum += bins[k];
+    return sum;
+  }
+
   struct Communicator {
 
     /**
@@ -569,6 +627,8 @@ namespace quda
 
     char *enable_reduce_env = getenv("QUDA_DETERMINISTIC_REDUCE");
     if (enable_reduce_env && strcmp(enable_reduce_env, "1") == 0) { use_deterministic_reduce = true; }
+    if (use_deterministic_reduce && comm_size() > (1 << binned_max_terms_log2))
+      errorQuda("Deterministic reduction supports at most %d ranks", 1 << binned_max_terms_log2);
 
     snprintf(partition_string, 16, ",comm=%d%d%d%d", comm_dim_partitioned(0), comm_dim_partitioned(1),
              comm_dim_partitioned(2), comm_dim_partitioned(3));
@@ -747,14 +807,14 @@ namespace quda
 
   int comm_query(MsgHandle *mh);
 
-  template <typename T> T deterministic_reduce(T *array, int n)
-  {
-    std::sort(array, array + n); // sort reduction into ascending order for deterministic reduction
-    return std::accumulate(array, array + n, 0.0);
-  }
-
   void comm_allreduce_sum_array(double *data, size_t size);
 
+  ReduceHandle *comm_allreduce_sum_array_start(double *data, size_t size);
+
+  bool comm_allreduce_test(ReduceHandle *rh);
+
+  void comm_allreduce_wait(ReduceHandle *&rh);
+
   void comm_allreduce_sum(size_t &a);
 
   void comm_allreduce_max_array(double *data, size_t size);
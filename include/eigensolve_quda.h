@@ -1,10 +1,13 @@
 #pragma once
 
+#include <memory>
 #include <quda.h>
 #include <quda_internal.h>
 #include <timer.h>
 #include <dirac_quda.h>
 #include <color_spinor_field.h>
+#include <transfer.h>
+#include <vector_io.h>
 #include <eigen_helper.h>
 
 namespace quda
@@ -58,6 +61,18 @@ namespace quda
 
     QudaPrecision save_prec = QUDA_INVALID_PRECISION;
 
+    // Local-coherence compression of the converged eigenvectors
+    std::vector<ColorSpinorField> compress_basis = {}; /** Block basis (only the first is kept for meta data) */
+    std::unique_ptr<Transfer> compress_transfer;        /** Maps between eigenvectors and their coefficients */
+    ColorSpinorParam compress_fine_param;               /** Fine temporaries at the transfer precision */
+    ColorSpinorParam compress_coarse_param;             /** Coarse temporaries at the transfer precision */
+
+    // Checkpointing of the eigensolver state between restarts
+    int checkpoint_slot = 1;                /** Vector file slot holding the last complete checkpoint */
+    size_t checkpoint_n_vec = 0;            /** Number of vectors in the checkpoint being restored */
+    std::unique_ptr<VectorIO> checkpoint_io; /** Checkpoint whose vectors are still being written */
+    std::string checkpoint_meta;            /** Metadata to commit once checkpoint_io completes */
+
   public:
     /**
        @brief Constructor for base Eigensolver class
@@ -134,6 +149,72 @@ namespace quda
     */
     void cleanUpEigensolver(std::vector<ColorSpinorField> &kSpace, std::vector<Complex> &evals);
 
+    /**
+       @brief Compress the converged eigenvectors using local
+       coherence.  The leading compress_n_basis eigenvectors are block
+       orthonormalized over blocks of size compress_block_size, and
+       every eigenvector is replaced by its coarse coefficients with
+       respect to this basis, stored in compress_precision.
+       @param[in,out] kSpace On entry the converged eigenvectors, on
+       exit their compressed coefficients
+    */
+    void compressEigenvectors(std::vector<ColorSpinorField> &kSpace);
+
+    /**
+       @brief Expand compressed eigenvectors to the fine grid
+       @param[out] out The expanded eigenvectors
+       @param[in] in The compressed eigenvector coefficients
+    */
+    void decompress(cvector_ref<ColorSpinorField> &out, cvector_ref<const ColorSpinorField> &in) const;
+
+    /**
+       @return Whether the eigenvectors held by the caller have been compressed
+    */
+    bool compressed() const { return compress_transfer != nullptr; }
+
+    /**
+       @brief Write a checkpoint of the eigensolver state, if one is
+       due at this restart.  The vectors are written with
+       VectorIO::save_async, overlapping with the following restarts,
+       alternating between two files so that the previous checkpoint
+       survives a failure while writing.  The restart counters,
+       residua and solver-specific data go to a small metadata file
+       that is renamed into place by completeCheckpoint once the
+       vectors are complete.
+       @param[in] vecs The vectors that carry the Krylov space across the restart
+       @param[in] state Solver-specific data, e.g., the arrow matrix
+    */
+    void saveCheckpoint(cvector_ref<const ColorSpinorField> &vecs, const std::vector<double> &state);
+
+    /**
+       @brief Wait for the vectors of an outstanding checkpoint to be
+       written, then commit its metadata
+    */
+    void completeCheckpoint();
+
+    /**
+       @brief Look for a checkpoint written with the same parameters,
+       and if present restore the restart counters and residua.  A
+       checkpoint with no restarts left below max_restarts is ignored.
+       @param[in] meta Field that defines the Krylov space geometry
+       @param[out] state Solver-specific data, e.g., the arrow matrix
+       @return Whether a matching checkpoint was found
+    */
+    bool loadCheckpoint(const ColorSpinorField &meta, std::vector<double> &state);
+
+    /**
+       @brief Load the vectors of the checkpoint found by loadCheckpoint
+       @param[out] vecs The vectors that carry the Krylov space across the restart
+    */
+    void loadCheckpointVectors(cvector_ref<ColorSpinorField> &vecs);
+
+    /**
+       @brief Remove the checkpoint metadata and vector files once the
+       eigensolver has converged, so that subsequent runs start from
+       scratch
+    */
+    void removeCheckpoint();
+
     /**
        @brief Promoted the specified matVec operation:
        M, Mdag, MMdag, MdagM to a Chebyshev polynomial
@@ -117,6 +117,7 @@
 #define QUDA_CA_CGNE_INVERTER 20
 #define QUDA_CA_CGNR_INVERTER 21
 #define QUDA_CA_GCR_INVERTER 22
+#define QUDA_PIPELINED_CG_INVERTER 23
 #define QUDA_INVALID_INVERTER QUDA_INVALID_ENUM
 
 #define QudaEigType integer(4)
@@ -1,6 +1,8 @@
 #pragma once
 
+#include <cstdint>
 #include <string>
+#include <list>
 #include <map>
 #include <stack>
 #include <vector>
@@ -41,14 +43,61 @@ namespace quda {
   };
 
   /**
-     FieldTmp is a wrapper for a cached field.
+     FieldCacheStats holds the lifetime statistics for a given key
+     in the field cache.
+   */
+  struct FieldCacheStats {
+    uint64_t hits = 0;      /** Number of requests served from the cache */
+    uint64_t misses = 0;    /** Number of requests that required an allocation */
+    uint64_t evictions = 0; /** Number of cached fields freed to honor the byte budget */
+    size_t bytes = 0;       /** Size of each field with this key */
+  };
+
+  /**
+     FieldTmp is a wrapper for a cached field.  The total size of
+     released fields held in the cache can be bounded by setting
+     QUDA_FIELD_CACHE_MAX_MB, in which case the fields belonging to
+     the least-recently-used keys are freed first.
      @tparam T The field type
    */
   template <typename T>
   class FieldTmp {
-    static std::map<FieldKey<T>, std::stack<T>> cache; /** Field Cache */
-    T tmp;                                             /** The temporary field instance */
-    FieldKey<T> key;                                   /** Key associated with this instance */
+    /**
+       CacheEntry is the set of released fields for a given key
+       together with its position in the LRU order.
+     */
+    struct CacheEntry {
+      std::stack<T> fields;                                /** Released fields available for reuse */
+      typename std::list<FieldKey<T>>::iterator lru_entry; /** Position in the LRU list */
+    };
+
+    static std::map<FieldKey<T>, CacheEntry> cache;      /** Field Cache */
+    static std::list<FieldKey<T>> lru;                   /** Keys in order of last use, oldest first */
+    static std::map<FieldKey<T>, FieldCacheStats> stats; /** Lifetime statistics per key */
+    static size_t cache_bytes;                           /** Bytes currently held in the cache */
+    static size_t cache_bytes_peak;                      /** High-water mark of cache_bytes */
+    T tmp;                                               /** The temporary field instance */
+    FieldKey<T> key;                                     /** Key associated with this instance */
+
+    /**
+       @brief Pop a field matching key from the cache into tmp if one
+       is present, updating the statistics.
+       @return Whether a cached field was found
+    */
+    bool acquire();
+
+    /**
+       @brief Mark key as the most recently used, creating its cache
+       entry if needed
+       @return The cache entry for key
+    */
+    static CacheEntry &touch(const FieldKey<T> &key);
+
+    /**
+       @brief Free cached fields, least-recently-used keys first,
+       until the cache fits within the byte budget
+    */
+    static void evict();
 
   public:
     /**
@@ -97,6 +146,18 @@ namespace quda {
 
     /** @brief Flush the cache and frees all temporary allocations */
     static void destroy();
+
+    /**
+       @brief Return the byte budget of the cache, as set by
+       QUDA_FIELD_CACHE_MAX_MB (0 = unlimited)
+    */
+    static size_t max_bytes();
+
+    /**
+       @brief Print the per-key hit, miss and eviction statistics
+       accumulated over the lifetime of the cache
+    */
+    static void print_stats();
   };
 
   /**
@@ -418,6 +418,14 @@ namespace quda {
     */
     void exchangeExtendedGhost(const lat_dim_t &R, TimeProfile &profile, bool no_comms_fill = false);
 
+    /**
+       @brief Release the persistent host buffers and message handles
+       used by exchangeExtendedGhost for host fields.  These are
+       retained per face geometry so that repeated exchanges of
+       extended fields avoid reallocation and handle setup.
+    */
+    static void freeExtendedGhostBuffer();
+
     void checkField(const LatticeField &) const;
 
     /**
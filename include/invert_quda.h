@@ -871,6 +871,51 @@ namespace quda {
     virtual QudaInverterType getInverterType() const override { return QUDA_CG3_INVERTER; }
   };
 
+  /**
+     @brief Pipelined conjugate gradient.  The inner products of each
+     iteration are fused into a single non-blocking global reduction
+     which is overlapped with the operator application, at the cost
+     of three extra vector recurrences.  Reliable updates trigger
+     residual replacement to counter the resulting drift.
+   */
+  class PipelinedCG : public Solver
+  {
+
+  private:
+    std::vector<ColorSpinorField> y;
+    std::vector<ColorSpinorField> r;
+    std::vector<ColorSpinorField> r_sloppy;
+    std::vector<ColorSpinorField> x_sloppy;
+    std::vector<ColorSpinorField> p; // search direction
+    std::vector<ColorSpinorField> s; // s = A p
+    std::vector<ColorSpinorField> z; // z = A s
+    std::vector<ColorSpinorField> w; // w = A r
+    std::vector<ColorSpinorField> q; // q = A w
+    bool init = false;
+
+    /**
+       @brief Initiate the fields needed by the solver
+       @param[in] x Solution vector
+       @param[in] b Source vector
+    */
+    void create(cvector_ref<ColorSpinorField> &x, cvector_ref<const ColorSpinorField> &b);
+
+  public:
+    PipelinedCG(const DiracMatrix &mat, const DiracMatrix &matSloppy, const DiracMatrix &matPrecon,
+                const DiracMatrix &matEig, SolverParam &param);
+
+    void operator()(cvector_ref<ColorSpinorField> &out, cvector_ref<const ColorSpinorField> &in) override;
+
+    /**
+       @return Return the residual vector from the prior solve
+    */
+    cvector_ref<const ColorSpinorField> get_residual() override;
+
+    virtual bool hermitian() const override { return true; } /** CG is only for Hermitian systems */
+
+    virtual QudaInverterType getInverterType() const override { return QUDA_PIPELINED_CG_INVERTER; }
+  };
+
   class PCG : public Solver
   {
     std::shared_ptr<Solver> K;
@@ -1497,7 +1542,7 @@ public:
        @param[in] hermitian Whether the linear system is Hermitian or not
     */
     void solve(std::vector<Complex> &psi_, std::vector<ColorSpinorField> &p, std::vector<ColorSpinorField> &q,
-               const ColorSpinorField &b, bool hermitian);
+               cvector_ref<const ColorSpinorField> &b, bool hermitian);
 
   public:
     /**
@@ -1508,26 +1553,28 @@ public:
     MinResExt(const DiracMatrix &mat, bool orthogonal, bool apply_mat, bool hermitian);
 
     /**
-       @param x The optimum for the solution vector.
+       @param x The optimum for the solution vectors.
 
-       @param b The source vector in the equation to be solved. This is not preserved.
+       @param b The source vectors in the equation to be solved.  All
+       sources share the basis, its orthogonalization and the
+       factorized projected matrix.
        @param p The basis vectors in which we are building the guess
        @param q The basis vectors multiplied by A
     */
-    void operator()(ColorSpinorField &x, const ColorSpinorField &b, std::vector<ColorSpinorField> &p,
-                    std::vector<ColorSpinorField> &q);
+    void operator()(cvector_ref<ColorSpinorField> &x, cvector_ref<const ColorSpinorField> &b,
+                    std::vector<ColorSpinorField> &p, std::vector<ColorSpinorField> &q);
   };
 
   /**
      @brief Driver for using MinResExt from the context of molecular dynamics
-     @param[out] x Construct solution prediction
-     @param[in] b Source against which we are solving
+     @param[out] x Construct solution predictions
+     @param[in] b Sources against which we are solving
      @param[in,out] basis Basis vectors (orthogonalized during the process)
      @param[in] m Linear operator we are solving against
      @param[in] hermitian Whether the operator is Hermitian or not
    */
-  void chronoExtrapolate(ColorSpinorField &x, const ColorSpinorField &b, std::vector<ColorSpinorField> &basis,
-                         DiracMatrix &m, bool hermitian);
+  void chronoExtrapolate(cvector_ref<ColorSpinorField> &x, cvector_ref<const ColorSpinorField> &b,
+                         std::vector<ColorSpinorField> &basis, DiracMatrix &m, bool hermitian);
 
   using ColorSpinorFieldSet = ColorSpinorField;
 
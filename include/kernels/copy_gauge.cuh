@@ -97,6 +97,89 @@ namespace quda {
     }
   };
 
+  /**
+     Raw access to the orders that have a specialized tiled copy: the
+     MILC (site-major) and QDP (direction-major) application orders,
+     which store each link as a contiguous array of reals, copied to
+     the native FloatN order when it is uncompressed and not
+     fixed-point.
+  */
+  template <typename Order> struct tiled_in : std::false_type {
+  };
+
+  template <typename Float, int length> struct tiled_in<MILCOrder<Float, length>> : std::true_type {
+    static const Float *link(const MILCOrder<Float, length> &in, int d, int x, int parity)
+    {
+      return in.gauge + ((static_cast<size_t>(parity) * in.volumeCB + x) * in.geometry + d) * length;
+    }
+  };
+
+  template <typename Float, int length> struct tiled_in<QDPOrder<Float, length>> : std::true_type {
+    static const Float *link(const QDPOrder<Float, length> &in, int d, int x, int parity)
+    {
+      return in.gauge[d] + (static_cast<size_t>(parity) * in.volumeCB + x) * length;
+    }
+  };
+
+  template <typename Order> struct tiled_out : std::false_type {
+  };
+
+  template <typename Float, int length, int N, QudaStaggeredPhase stag_phase, bool huge_alloc,
+            QudaGhostExchange ghostExchange, bool use_inphase>
+  struct tiled_out<FloatNOrder<Float, length, N, length, stag_phase, huge_alloc, ghostExchange, use_inphase>>
+    : std::integral_constant<bool, !isFixed<Float>::value> {
+    using Order = FloatNOrder<Float, length, N, length, stag_phase, huge_alloc, ghostExchange, use_inphase>;
+    static constexpr int n = N;
+    /** @return Pointer to the i-th vector of direction d at site 0 */
+    static Float *chunk(const Order &out, int d, int i, int parity)
+    {
+      return out.gauge + (parity * out.offset + static_cast<size_t>(d * (length / N) + i) * out.stride) * N;
+    }
+  };
+
+  /**
+     @brief Host gauge reordering, where each thread copies a tile of
+     consecutive sites for one parity and direction.  From the MILC or
+     QDP orders to uncompressed FloatN, the tile is transposed
+     directly: each vector of the output is written for the whole tile
+     in one contiguous run, while the tile of input links stays in
+     cache.  Other order pairs go through the order accessors, one
+     link at a time.
+  */
+  template <typename Arg> struct CopyGaugeTiled_ {
+    static constexpr int tile = 64;
+    using in_t = std::remove_const_t<decltype(Arg::in)>;
+    using out_t = decltype(Arg::out);
+    const Arg &arg;
+    constexpr CopyGaugeTiled_(const Arg &arg) : arg(arg) {}
+    static constexpr const char *filename() { return KERNEL_FILE; }
+
+    inline void operator()(int t, int, int parity_d)
+    {
+      int parity = parity_d / arg.geometry;
+      int d = parity_d % arg.geometry;
+      int x_begin = t * tile;
+      int x_end = std::min((t + 1) * tile, arg.volume / 2);
+
+      if constexpr (tiled_in<in_t>::value && tiled_out<out_t>::value) {
+        constexpr int N = tiled_out<out_t>::n;
+        for (int i = 0; i < Arg::length / N; i++) {
+          auto out = tiled_out<out_t>::chunk(arg.out, d, i, parity);
+          for (int x = x_begin; x < x_end; x++) {
+            auto in = tiled_in<in_t>::link(arg.in, d, x, parity) + i * N;
+            for (int j = 0; j < N; j++) out[x * N + j] = in[j];
+          }
+        }
+      } else {
+        for (int x = x_begin; x < x_end; x++) {
+          Matrix<complex<typename Arg::real_in_t>, Arg::nColor> in = arg.in(d, x, parity);
+          Matrix<complex<typename Arg::real_out_t>, Arg::nColor> out = in;
+          arg.out(d, x, parity) = out;
+        }
+      }
+    }
+  };
+
   /**
      @brief Generic gauge ghost reordering and packing
   */
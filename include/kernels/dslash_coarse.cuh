@@ -355,6 +355,9 @@ namespace quda {
       int s = sM / (Arg::nColor/Mc);
       int color_block = (sM % (Arg::nColor/Mc)) * Mc;
 
+      // on the host each thread gathers both directions (see applyDslash), so the dir = 1 threads have no work
+      if (target::is_host() && (dir || dim)) return;
+
       array<complex <typename Arg::real>, Mc> out{ };
 
       if (Arg::dslash) {
@@ -2,7 +2,7 @@
 #include <gauge_field_order.h>
 #include <index_helper.cuh>
 #include <atomic_helper.h>
-#include <random_helper.h>
+#include <random_accessor.cuh>
 #include <kernel.h>
 
 namespace quda {
@@ -74,8 +74,8 @@ namespace quda {
     @param al weight
     @param localstate CURAND rng state
  */
-  template <class T>
-  __device__ inline Matrix<T,2> generate_su2_matrix_milc(T al, RNGState& localState)
+  template <class T, typename State>
+  __device__ inline Matrix<T,2> generate_su2_matrix_milc(T al, State& localState)
   {
     T xr1 = uniform<T>::rand(localState);
     xr1 = (log((xr1 + static_cast<T>(1.e-10))));
@@ -294,9 +294,9 @@ namespace quda {
     @param F staple
     @param localstate CURAND rng state
   */
-  template <class Float, int nColor>
+  template <class Float, int nColor, typename State>
   __device__ inline void heatBathSUN( Matrix<complex<Float>,nColor>& U, Matrix<complex<Float>,nColor> F,
-                                      RNGState& localState, Float BetaOverNc )
+                                      State& localState, Float BetaOverNc )
   {
     if (nColor == 3) {
       //////////////////////////////////////////////////////////////////
@@ -583,10 +583,10 @@ namespace quda {
     int border[4];
     Gauge dataOr;
     Float BetaOverNc;
-    RNGState *rng;
+    RNGAccessor rng;
     int mu;
     int parity;
-    MonteArg(GaugeField &data, Float Beta, RNGState *rng, int mu, int parity) :
+    MonteArg(GaugeField &data, Float Beta, const RNGAccessor &rng, int mu, int parity) :
       kernel_param(dim3(data.LocalVolumeCB(), 1, 1)),
       dataOr(data),
       rng(rng),
@@ -653,9 +653,8 @@ namespace quda {
         }
       U = arg.dataOr(mu, e_cb, parity);
       if (Arg::heatbath) {
-        RNGState localState = arg.rng[x_cb];
-        heatBathSUN( U, conj(staple), localState, arg.BetaOverNc );
-        arg.rng[x_cb] = localState;
+        rng_apply(arg.rng, x_cb, parity, x_cb,
+                  [&](auto &localState) { heatBathSUN(U, conj(staple), localState, arg.BetaOverNc); });
       } else {
         overrelaxationSUN( U, conj(staple) );
       }
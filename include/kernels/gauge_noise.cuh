@@ -1,7 +1,7 @@
 #include <quda_matrix.h>
 #include <gauge_field_order.h>
 #include <index_helper.cuh>
-#include <random_helper.h>
+#include <random_accessor.cuh>
 #include <kernel.h>
 
 namespace quda {
@@ -19,10 +19,10 @@ namespace quda {
     int X[4]; // true grid dimensions
     int border[4];
     Gauge U;
-    RNGState *rng;
+    RNGAccessor rng;
     real sigma; // where U = exp(sigma * H)
 
-    GaugeNoiseArg(const GaugeField &U, RNGState *rng) :
+    GaugeNoiseArg(const GaugeField &U, const RNGAccessor &rng) :
       kernel_param(dim3(U.LocalVolumeCB(), 2, 1)),
       geometry(U.Geometry()),
       U(U),
@@ -36,8 +36,8 @@ namespace quda {
     }
   };
 
-  template<typename real, typename Arg> // Gauss
-  __device__ __host__ inline void genGauss(Arg &arg, RNGState& localState, int parity, int x_cb, int g, int r, int c)
+  template<typename real, typename Arg, typename State> // Gauss
+  __device__ __host__ inline void genGauss(Arg &arg, State& localState, int parity, int x_cb, int g, int r, int c)
   {
     real phi = 2.0 * uniform<real>::rand(localState);
     real radius = uniform<real>::rand(localState);
@@ -47,8 +47,8 @@ namespace quda {
     arg.U(g, parity, x_cb, r, c) = radius * complex<real>(phi_cos, phi_sin);
   }
 
-  template<typename real, typename Arg> // Uniform
-  __device__ __host__ inline void genUniform(Arg &arg, RNGState& localState, int parity, int x_cb, int g, int r, int c)
+  template<typename real, typename Arg, typename State> // Uniform
+  __device__ __host__ inline void genUniform(Arg &arg, State& localState, int parity, int x_cb, int g, int r, int c)
   {
     real x = uniform<real>::rand(localState);
     real y = uniform<real>::rand(localState);
@@ -67,18 +67,20 @@ namespace quda {
       for (int dr = 0; dr < 4; ++dr) x[dr] += arg.border[dr]; // extended grid coordinates
       int e_cb = linkIndex(x, arg.E);
 
-      RNGState localState = arg.rng[parity * arg.threads.x + x_cb];
-      for (int g = 0; g < arg.geometry; g++) {
-        for (int r = 0; r < Arg::nColor; r++) {
-          for (int c = 0; c < Arg::nColor; c++) {
+      rng_apply(arg.rng, x_cb, parity, parity * arg.threads.x + x_cb, [&](auto &localState) {
+        for (int g = 0; g < arg.geometry; g++) {
+          for (int r = 0; r < Arg::nColor; r++) {
+            for (int c = 0; c < Arg::nColor; c++) {
 
-            if (Arg::noise == QUDA_NOISE_GAUSS) genGauss<typename Arg::real>(arg, localState, parity, e_cb, g, r, c);
-            else if (Arg::noise == QUDA_NOISE_UNIFORM) genUniform<typename Arg::real>(arg, localState, parity, e_cb, g, r, c);
+              if (Arg::noise == QUDA_NOISE_GAUSS)
+                genGauss<typename Arg::real>(arg, localState, parity, e_cb, g, r, c);
+              else if (Arg::noise == QUDA_NOISE_UNIFORM)
+                genUniform<typename Arg::real>(arg, localState, parity, e_cb, g, r, c);
 
+            }
           }
         }
-      }
-      arg.rng[parity * arg.threads.x + x_cb] = localState;
+      });
     }
   };
 
@@ -1,7 +1,7 @@
 #include <quda_matrix.h>
 #include <gauge_field_order.h>
 #include <index_helper.cuh>
-#include <random_helper.h>
+#include <random_accessor.cuh>
 #include <kernel.h>
 
 namespace quda {
@@ -20,10 +20,10 @@ namespace quda {
     int X[4]; // true grid dimensions
     int border[4];
     Gauge U;
-    RNGState *rng;
+    RNGAccessor rng;
     real sigma; // where U = exp(sigma * H)
 
-    GaugeGaussArg(const GaugeField &U, RNGState *rng, double sigma) :
+    GaugeGaussArg(const GaugeField &U, const RNGAccessor &rng, double sigma) :
       kernel_param(dim3(U.LocalVolumeCB(), 2, 1)),
       U(U),
       rng(rng),
@@ -37,7 +37,7 @@ namespace quda {
     }
   };
 
-  template <typename real, typename Link> __device__ __host__ Link gauss_su3(RNGState &localState)
+  template <typename real, typename Link, typename State> __device__ __host__ Link gauss_su3(State &localState)
   {
     Link ret;
     real rand1[4], rand2[4], phi[4], radius[4], temp1[4], temp2[4];
@@ -92,18 +92,16 @@ namespace quda {
         Link O = {};
         for (int mu = 0; mu < 4; mu++) arg.U(mu, linkIndex(x, arg.E), parity) = O;
       } else {
-        for (int mu = 0; mu < 4; mu++) {
-          RNGState localState = arg.rng[parity * arg.threads.x + x_cb];
-
-          // generate Gaussian distributed su(n) field
-          Link u = arg.sigma * gauss_su3<real, Link>(localState);
-          if constexpr (Arg::group) {
-            expsu3<real>(u);
+        rng_apply(arg.rng, x_cb, parity, parity * arg.threads.x + x_cb, [&](auto &localState) {
+          for (int mu = 0; mu < 4; mu++) {
+            // generate Gaussian distributed su(n) field
+            Link u = arg.sigma * gauss_su3<real, Link>(localState);
+            if constexpr (Arg::group) {
+              expsu3<real>(u);
+            }
+            arg.U(mu, linkIndex(x, arg.E), parity) = u;
           }
-          arg.U(mu, linkIndex(x, arg.E), parity) = u;
-
-          arg.rng[parity * arg.threads.x + x_cb] = localState;
-        }
+        });
       }
     }
   };
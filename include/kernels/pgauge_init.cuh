@@ -1,6 +1,6 @@
 #include <quda_matrix.h>
 #include <gauge_field_order.h>
-#include <random_helper.h>
+#include <random_accessor.cuh>
 #include <index_helper.cuh>
 #include <kernel.h>
 
@@ -50,9 +50,9 @@ namespace quda {
     using Gauge = typename gauge_mapper<real, recon>::type;
     int X[4]; // grid dimensions
     Gauge U;
-    RNGState *rng;
+    RNGAccessor rng;
     int border[4];
-    InitGaugeHotArg(const GaugeField &U, RNGState *rng) :
+    InitGaugeHotArg(const GaugeField &U, const RNGAccessor &rng) :
       //the optimal number of RNG states in rngstate array must be equal to half the lattice volume
       //this number is the same used in heatbath...
       kernel_param(dim3(U.LocalVolumeCB(), 1, 1)),
@@ -111,8 +111,8 @@ namespace quda {
      @param localstate CURAND rng state
      @return four real numbers of the SU(2) matrix
   */
-  template <class T>
-  __device__ static inline Matrix<T,2> randomSU2(RNGState& localState){
+  template <class T, typename State>
+  __device__ static inline Matrix<T,2> randomSU2(State& localState){
     Matrix<T,2> a;
     T aabs, ctheta, stheta, phi;
     a(0,0) = uniform<T>::rand(localState, (T)-1.0, (T)1.0);
@@ -177,8 +177,8 @@ namespace quda {
      @param localstate CURAND rng state
      @return SU(Nc) matrix
   */
-  template <class Float, int nColor>
-  __device__ inline Matrix<complex<Float>,nColor> randomize( RNGState& localState )
+  template <class Float, int nColor, typename State>
+  __device__ inline Matrix<complex<Float>,nColor> randomize( State& localState )
   {
     Matrix<complex<Float>,nColor> U;
 
@@ -208,18 +208,18 @@ namespace quda {
       int X[4], x[4];
       for ( int dr = 0; dr < 4; ++dr ) X[dr] = arg.X[dr];
       for ( int dr = 0; dr < 4; ++dr ) X[dr] += 2 * arg.border[dr];
-      RNGState localState = arg.rng[x_cb];
-      for (int parity = 0; parity < 2; parity++) {
-        getCoords(x, x_cb, arg.X, parity);
-        for (int dr = 0; dr < 4; dr++) x[dr] += arg.border[dr];
-        int e_cb = linkIndex(x, X);
-        for (int d = 0; d < 4; d++) {
-          Matrix<complex<typename Arg::real>, Arg::nColor> U;
-          U = randomize<typename Arg::real, Arg::nColor>(localState);
-          arg.U(d, e_cb, parity) = U;
+      rng_apply(arg.rng, x_cb, 0, x_cb, [&](auto &localState) {
+        for (int parity = 0; parity < 2; parity++) {
+          getCoords(x, x_cb, arg.X, parity);
+          for (int dr = 0; dr < 4; dr++) x[dr] += arg.border[dr];
+          int e_cb = linkIndex(x, X);
+          for (int d = 0; d < 4; d++) {
+            Matrix<complex<typename Arg::real>, Arg::nColor> U;
+            U = randomize<typename Arg::real, Arg::nColor>(localState);
+            arg.U(d, e_cb, parity) = U;
+          }
         }
-      }
-      arg.rng[x_cb] = localState;
+      });
     }
   };
 
@@ -1,6 +1,6 @@
 #include <math_helper.cuh>
 #include <color_spinor_field_order.h>
-#include <random_helper.h>
+#include <random_accessor.cuh>
 #include <kernel.h>
 
 namespace quda {
@@ -16,15 +16,15 @@ namespace quda {
     static constexpr QudaNoiseType noise = noise_;
     using V = typename colorspinor::FieldOrderCB<real, nSpin, nColor, 1, order>;
     V v;
-    RNGState *rng;
-    SpinorNoiseArg(ColorSpinorField &v, RNGState *rng) :
+    RNGAccessor rng;
+    SpinorNoiseArg(ColorSpinorField &v, const RNGAccessor &rng) :
       kernel_param(dim3(v.VolumeCB(), v.SiteSubset(), 1)),
       v(v),
       rng(rng) { }
   };
 
-  template<typename real, typename Arg> // Gauss
-  __device__ __host__ inline void genGauss(Arg &arg, RNGState& localState, int parity, int x_cb, int s, int c) {
+  template<typename real, typename Arg, typename State> // Gauss
+  __device__ __host__ inline void genGauss(Arg &arg, State& localState, int parity, int x_cb, int s, int c) {
     real phi = 2.0 * uniform<real>::rand(localState);
     real radius = uniform<real>::rand(localState);
     radius = sqrt(-log(radius));
@@ -33,8 +33,8 @@ namespace quda {
     arg.v(parity, x_cb, s, c) = radius * complex<real>(phi_cos, phi_sin);
   }
 
-  template<typename real, typename Arg> // Uniform
-  __device__ __host__ inline void genUniform(Arg &arg, RNGState& localState, int parity, int x_cb, int s, int c) {
+  template<typename real, typename Arg, typename State> // Uniform
+  __device__ __host__ inline void genUniform(Arg &arg, State& localState, int parity, int x_cb, int s, int c) {
     real x = uniform<real>::rand(localState);
     real y = uniform<real>::rand(localState);
     arg.v(parity, x_cb, s, c) = complex<real>(x, y);
@@ -47,14 +47,16 @@ namespace quda {
 
     __device__ __host__ void operator()(int x_cb, int parity)
     {
-      RNGState localState = arg.rng[parity * arg.threads.x + x_cb];
-      for (int s=0; s<Arg::nSpin; s++) {
-        for (int c=0; c<Arg::nColor; c++) {
-          if (Arg::noise == QUDA_NOISE_GAUSS) genGauss<typename Arg::real>(arg, localState, parity, x_cb, s, c);
-          else if (Arg::noise == QUDA_NOISE_UNIFORM) genUniform<typename Arg::real>(arg, localState, parity, x_cb, s, c);
+      rng_apply(arg.rng, x_cb, parity, parity * arg.threads.x + x_cb, [&](auto &localState) {
+        for (int s=0; s<Arg::nSpin; s++) {
+          for (int c=0; c<Arg::nColor; c++) {
+            if (Arg::noise == QUDA_NOISE_GAUSS)
+              genGauss<typename Arg::real>(arg, localState, parity, x_cb, s, c);
+            else if (Arg::noise == QUDA_NOISE_UNIFORM)
+              genUniform<typename Arg::real>(arg, localState, parity, x_cb, s, c);
+          }
         }
-      }
-      arg.rng[parity * arg.threads.x + x_cb] = localState;
+      });
     }
   };
 
@@ -154,6 +154,21 @@ namespace quda {
     */
     void pinned_free_(const char *func, const char *file, int line, void *ptr);
 
+    /**
+       @brief Allocate host-memory.  If a free pre-existing allocation
+       exists reuse this, else allocate and first touch the pages in
+       parallel from the OpenMP threads.
+       @param size Size of allocation
+       @return Pointer to allocated memory
+    */
+    void *host_malloc_(const char *func, const char *file, int line, size_t size);
+
+    /**
+       @brief Virtual free of host-memory allocation.
+       @param ptr Pointer to be (virtually) freed
+    */
+    void host_free_(const char *func, const char *file, int line, void *ptr);
+
     /**
        @brief Free all outstanding device-memory allocations.
     */
@@ -164,6 +179,13 @@ namespace quda {
     */
     void flush_pinned();
 
+    /**
+       @brief Free all outstanding host-memory allocations.  Cached
+       host memory is otherwise only returned to the system once it
+       exceeds QUDA_HOST_MEMORY_POOL_LIMIT MiB (default 1024).
+    */
+    void flush_host();
+
   } // namespace pool
 
 }
@@ -172,3 +194,5 @@ namespace quda {
 #define pool_device_free(ptr) quda::pool::device_free_(__func__, __FILE__, __LINE__, ptr)
 #define pool_pinned_malloc(size) quda::pool::pinned_malloc_(__func__, __FILE__, __LINE__, size)
 #define pool_pinned_free(ptr) quda::pool::pinned_free_(__func__, __FILE__, __LINE__, ptr)
+#define pool_host_malloc(size) quda::pool::host_malloc_(__func__, __FILE__, __LINE__, size)
+#define pool_host_free(ptr) quda::pool::host_free_(__func__, __FILE__, __LINE__, ptr)
@@ -2,6 +2,7 @@
 
 #include <invert_quda.h>
 #include <transfer.h>
+#include <vector_io.h>
 #include <vector>
 #include <complex_quda.h>
 #include <memory>
@@ -299,6 +300,9 @@ namespace quda {
     /** The coarse-grid representation of the null space vectors */
     std::vector<ColorSpinorField> B_coarse;
 
+    /** Save of the null space vectors that may still be writing, overlapping with the setup */
+    mutable std::unique_ptr<VectorIO> vector_io;
+
     /** Residual vector set */
     std::vector<ColorSpinorField> r;
 
@@ -454,7 +458,9 @@ namespace quda {
     void loadVectors(cvector_ref<ColorSpinorField> &B);
 
     /**
-       @brief Save the null space vectors in from file
+       @brief Save the null space vectors in from file.  The file is
+       written in the background, and is complete once the next save
+       starts or this level is destroyed.
        @param B Save null-space vectors from here
     */
     void saveVectors(cvector_ref<const ColorSpinorField> &B) const;
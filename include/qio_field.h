@@ -1,5 +1,7 @@
 #pragma once
 
+#include <functional>
+
 #ifdef HAVE_QIO
 void read_gauge_field(const char *filename, void *gauge[], QudaPrecision prec, const int *X,
 		      int argc, char *argv[]);
@@ -9,6 +11,69 @@ void read_spinor_field(const char *filename, void *V[], QudaPrecision precision,
 void write_spinor_field(const char *filename, const void *V[], QudaPrecision precision, const int *X,
                         QudaSiteSubset subset, QudaParity parity, int nColor, int nSpin, int Nvec, int argc,
                         char *argv[], bool partfile = false);
+
+/**
+   @brief Make a private duplicate of the QMP default communicator the
+   default, so that QIO may run on a helper thread while the main
+   thread communicates on the original.  The layout for local lattice
+   X is set up first, while the original still carries the logical
+   topology, and is used by the next open_spinor_field_reader or
+   open_spinor_field_writer.  Collective; must be called from the
+   main thread.
+*/
+void qio_begin_private_comm(const int *X, QudaSiteSubset subset);
+
+/**
+   @brief Restore the default communicator replaced by
+   qio_begin_private_comm, once the helper thread has closed its file
+*/
+void qio_end_private_comm();
+
+/**
+   @brief Open a spinor field file for reading one record at a time.
+   QIO keeps the lattice layout in global state, so no other QIO
+   file may be opened until the reader is closed.  The
+   open/read/close calls are collective, and must be made from the
+   main thread unless they are bracketed by qio_begin_private_comm
+   and qio_end_private_comm, in which case they may all be made from
+   one helper thread.
+   @return Opaque reader handle
+*/
+void *open_spinor_field_reader(const char *filename, const int *X, QudaSiteSubset subset);
+
+/**
+   @brief Read the next spinor field record.  get_chunk(n) is called
+   with the record's field count and must return n destination
+   pointers.
+   @param[in] Nmax Maximum number of fields the record may hold
+   @return The number of fields read
+*/
+int read_spinor_field_record(void *reader, QudaPrecision precision, int nColor, int nSpin, int Nmax,
+                             const std::function<void **(int n)> &get_chunk);
+
+/**
+   @brief Close a reader returned by open_spinor_field_reader
+*/
+void close_spinor_field_reader(void *reader);
+
+/**
+   @brief Open a spinor field file for writing one record at a time,
+   with the same restrictions as open_spinor_field_reader.
+   @return Opaque writer handle
+*/
+void *open_spinor_field_writer(const char *filename, const int *X, QudaSiteSubset subset, bool partfile = false);
+
+/**
+   @brief Write n spinor fields V[0..n) as the next record
+*/
+void write_spinor_field_record(void *writer, const void *V[], QudaPrecision precision, QudaSiteSubset subset,
+                               QudaParity parity, int nColor, int nSpin, int n);
+
+/**
+   @brief Close a writer returned by open_spinor_field_writer
+*/
+void close_spinor_field_writer(void *writer);
+
 #else
 inline void read_gauge_field(const char *, void *[], QudaPrecision, const int *, int, char *[])
 {
@@ -32,5 +97,45 @@ inline void write_spinor_field(const char *, const void *[], QudaPrecision, cons
   printf("QIO support has not been enabled\n");
   exit(-1);
 }
+inline void qio_begin_private_comm(const int *, QudaSiteSubset)
+{
+  printf("QIO support has not been enabled\n");
+  exit(-1);
+}
+inline void qio_end_private_comm()
+{
+  printf("QIO support has not been enabled\n");
+  exit(-1);
+}
+inline void *open_spinor_field_reader(const char *, const int *, QudaSiteSubset)
+{
+  printf("QIO support has not been enabled\n");
+  exit(-1);
+}
+inline int read_spinor_field_record(void *, QudaPrecision, int, int, int, const std::function<void **(int)> &)
+{
+  printf("QIO support has not been enabled\n");
+  exit(-1);
+}
+inline void close_spinor_field_reader(void *)
+{
+  printf("QIO support has not been enabled\n");
+  exit(-1);
+}
+inline void *open_spinor_field_writer(const char *, const int *, QudaSiteSubset, bool = false)
+{
+  printf("QIO support has not been enabled\n");
+  exit(-1);
+}
+inline void write_spinor_field_record(void *, const void *[], QudaPrecision, QudaSiteSubset, QudaParity, int, int, int)
+{
+  printf("QIO support has not been enabled\n");
+  exit(-1);
+}
+inline void close_spinor_field_writer(void *)
+{
+  printf("QIO support has not been enabled\n");
+  exit(-1);
+}
 
 #endif
@@ -610,6 +610,40 @@ extern "C" {
 
     /** Which external library to use in the deflation operations (Eigen) */
     QudaExtLibType extlib_type;
+
+    /** Geometric block size used to compress the converged
+        eigenvectors using local coherence.  The compressed vectors
+        are stored as coarse coefficients with respect to a
+        block-orthonormalized basis formed from the leading
+        eigenvectors, so this requires the multigrid transfer
+        operators to be built.  Defaults to 4^4. */
+    int compress_block_size[QUDA_MAX_DIM];
+
+    /** Number of leading eigenvectors used to form the compression
+        block basis (must be an instantiated multigrid Nvec, zero
+        disables compression) */
+    int compress_n_basis;
+
+    /** The precision with which to store the compressed eigenvector coefficients */
+    QudaPrecision compress_precision;
+
+    /** Output: bytes per rank of the compressed eigenvectors,
+        including the block basis (zero if not compressed) */
+    double compress_bytes;
+
+    /** Output: bytes per rank the eigenvectors occupied before
+        compression (zero if not compressed) */
+    double compress_full_bytes;
+
+    /** Filename prefix for periodic checkpoints of the eigensolver
+        state (TRLM, block TRLM and IRAM).  If a checkpoint written
+        with the same parameters is present, the eigensolver resumes
+        from it rather than starting from scratch.  An empty string
+        disables checkpointing. */
+    char checkpoint_file[256];
+
+    /** Number of restarts between eigensolver checkpoints */
+    int checkpoint_interval;
     //-------------------------------------------------
   } QudaEigParam;
 
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <random_quda.h>
+#include <random_helper.h>
+#include <index_helper.cuh>
+
+namespace quda
+{
+
+  /**
+     @brief Return the global lexicographical index of a site, which
+     is used as the sequence number of that site's generator.  Since
+     this only depends on the global coordinates, the random numbers
+     drawn at a site are independent of the process decomposition.
+     @param[in] rng The generator
+     @param[in] x_cb Local checkerboard site index
+     @param[in] parity Site parity
+     @return Global site index
+  */
+  __device__ __host__ inline unsigned long long rng_sequence(const RNGAccessor &rng, int x_cb, int parity)
+  {
+    int x[4];
+    getCoords(x, x_cb, rng.X, parity);
+    for (int i = 0; i < 4; i++) x[i] += rng.commCoord[i] * rng.X[i];
+    unsigned long long idx = x[3];
+    for (int i = 2; i >= 0; i--) idx = idx * rng.X_global[i] + x[i];
+    return idx;
+  }
+
+  /**
+     @brief Apply a functor to the generator of a given site.  For
+     the stateful generator, the site state is loaded from the state
+     array and written back afterwards.  For the counter-based
+     generator, the state is created in registers from (seed, global
+     site index, stream counter) and discarded afterwards.  Each
+     stream counter value reserves 2^32 draws per site.
+     @param[in] rng The generator
+     @param[in] x_cb Local checkerboard site index
+     @param[in] parity Site parity
+     @param[in] idx Index into the state array of the stateful generator
+     @param[in] f Functor that takes the generator state by reference
+  */
+  template <typename F>
+  __device__ __host__ inline void rng_apply(const RNGAccessor &rng, int x_cb, int parity, int idx, F &&f)
+  {
+    if (rng.state) {
+      RNGState localState = rng.state[idx];
+      f(localState);
+      rng.state[idx] = localState;
+    } else {
+      RNGCounterState localState;
+      random_init(rng.seed, rng_sequence(rng, x_cb, parity), rng.counter << 32, localState);
+      f(localState);
+    }
+  }
+
+} // namespace quda
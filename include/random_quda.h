@@ -9,16 +9,48 @@ namespace quda {
   // The nature of the state is defined in the target-specific implementation
   struct RNGState;
 
+  /**
+     @brief The random number generators that may back an RNG
+     instance.  The stateful generator (MRG32k3a or XORWOW) keeps a
+     persistent state for every lattice site in device memory.  The
+     counter-based generator (Philox4x32-10) keeps no per-site state:
+     each site's stream is derived on the fly from (seed, global site
+     index, stream counter), so it costs no memory, and the stream at
+     a given site does not depend on the process decomposition.
+     RNGType::DEFAULT selects the generator from the environment
+     variable QUDA_RNG_TYPE ("stateful" or "counter"), falling back to
+     the stateful generator if unset.
+  */
+  enum class RNGType { DEFAULT, STATEFUL, COUNTER };
+
+  /**
+     @brief Kernel-side view of an RNG.  For the stateful generator
+     state points to the per-site state array; for the counter-based
+     generator it is null and the remaining members are used to
+     construct each site's generator on the fly.
+  */
+  struct RNGAccessor {
+    RNGState *state = nullptr;        /*! per-site state array (stateful generator only) */
+    unsigned long long seed = 0;      /*! rng seed */
+    unsigned long long counter = 0;   /*! stream counter (counter-based generator only) */
+    int commCoord[QUDA_MAX_DIM] = {}; /*! process coordinates */
+    int X[QUDA_MAX_DIM] = {};         /*! local lattice dimensions */
+    int X_global[QUDA_MAX_DIM] = {};  /*! global lattice dimensions */
+  };
+
   /**
      @brief Class declaration to initialize and hold RNG states
   */
   class RNG
   {
 
-    size_t size;                     /*! @brief number of curand states */
-    std::shared_ptr<RNGState> state; /*! array with current curand rng state */
-    RNGState *backup_state;          /*! array for backup of current curand rng state */
-    unsigned long long seed;         /*! initial rng seed */
+    RNGType type;                          /*! which generator backs this instance */
+    size_t size;                           /*! @brief number of curand states */
+    std::shared_ptr<RNGState> state;       /*! array with current curand rng state */
+    RNGState *backup_state;                /*! array for backup of current curand rng state */
+    unsigned long long seed;               /*! initial rng seed */
+    RNGAccessor accessor;                  /*! kernel-side view of the generator */
+    unsigned long long backup_counter = 0; /*! backup of the stream counter */
 
   public:
     /**
@@ -26,18 +58,28 @@ namespace quda {
        takes its metadata from pre-existing field
        @param[in] meta The field whose data we use
        @param[in] seed Seed to initialize the RNG
+       @param[in] type Which generator to use
     */
-    RNG(const LatticeField &meta, unsigned long long seedin);
+    RNG(const LatticeField &meta, unsigned long long seedin, RNGType type = RNGType::DEFAULT);
 
     unsigned long long Seed() { return seed; };
 
+    /*! @brief Which generator backs this instance */
+    RNGType Type() const { return type; }
+
     /*! @brief Restore rng array states initialization */
     void restore();
 
     /*! @brief Backup rng array states initialization */
     void backup();
 
-    /*! @brief Get pointer to RNGState */
-    RNGState *State() { return state.get(); };
+    /**
+       @brief Return the kernel-side view of the generator for a
+       single kernel launch.  For the counter-based generator, this
+       advances the stream counter so that each launch draws fresh
+       random numbers, mirroring how the stateful generator advances
+       its state.
+    */
+    RNGAccessor Accessor();
   };
 }
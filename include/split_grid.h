@@ -14,6 +14,55 @@ namespace quda
 
   int comm_rank_from_coords(const int *coords);
 
+  /**
+     @brief Poll the posted receives, calling unpack(i) on each
+     receive i as soon as it has completed, in completion order.
+     @param[in] v_mh_recv Started receive message handles
+     @param[in] unpack Functor called with the replicate index
+   */
+  template <typename Unpack> void inline split_grid_progress(const std::vector<MsgHandle *> &v_mh_recv, Unpack &&unpack)
+  {
+    int n_replicates = v_mh_recv.size();
+    std::vector<bool> done(n_replicates, false);
+
+    for (int n_done = 0; n_done < n_replicates;) {
+      for (int i = 0; i < n_replicates; i++) {
+        if (done[i] || !comm_query(v_mh_recv[i])) continue;
+        unpack(i);
+        done[i] = true;
+        n_done++;
+      }
+    }
+  }
+
+  /**
+     @brief Complete the sends and return the message handles and
+     communication buffers.  Buffers are returned to the pinned pool,
+     so repeated split/join calls of the same size do not reallocate.
+   */
+  void inline split_grid_release(std::vector<MsgHandle *> &v_mh_send, std::vector<void *> &v_send_buffer_h,
+                                 std::vector<MsgHandle *> &v_mh_recv, std::vector<void *> &v_recv_buffer_h)
+  {
+    for (auto &p : v_mh_send) {
+      if (p) { comm_wait(p); }
+    }
+
+    comm_barrier();
+
+    for (auto &p : v_mh_send) {
+      if (p) { comm_free(p); }
+    }
+    for (auto &p : v_mh_recv) {
+      if (p) { comm_free(p); }
+    }
+    for (auto &p : v_send_buffer_h) {
+      if (p) { pool_pinned_free(p); }
+    }
+    for (auto &p : v_recv_buffer_h) {
+      if (p) { pool_pinned_free(p); }
+    }
+  }
+
   template <class Field>
   void inline split_field(Field &collect_field, cvector_ref<Field> &v_base_field, const CommKey &comm_key,
                           QudaPCType pc_type = QUDA_4D_PC)
@@ -44,39 +93,21 @@ namespace quda
     int n_replicates = product(comm_key);
     std::vector<void *> v_send_buffer_h(n_replicates, nullptr);
     std::vector<MsgHandle *> v_mh_send(n_replicates, nullptr);
+    std::vector<void *> v_recv_buffer_h(n_replicates, nullptr);
+    std::vector<MsgHandle *> v_mh_recv(n_replicates, nullptr);
 
     int n_fields = v_base_field.size();
     if (n_fields == 0) { errorQuda("split_field: input field vec has zero size."); }
 
     const auto &meta = v_base_field[0];
 
-    // Send cycles
-    for (int i = 0; i < n_replicates; i++) {
-      auto partition_idx = coordinate_from_index(i, comm_key); // Which partition to send to?
-      auto processor_idx = comm_grid_idx / partition_dim;      // Which processor in that partition to send to?
-
-      auto dst_idx = partition_idx * processor_dim + processor_idx;
-
-      int dst_rank = ::quda::comm_rank_from_coords(dst_idx.data());
-      int tag = rank * total_rank + dst_rank; // tag = src_rank * total_rank + dst_rank
-
-      size_t bytes = meta.TotalBytes();
-
-      v_send_buffer_h[i] = pinned_malloc(bytes);
-
-      v_base_field[i % n_fields].copy_to_buffer(v_send_buffer_h[i]);
-
-      v_mh_send[i] = comm_declare_send_rank(v_send_buffer_h[i], dst_rank, tag, bytes);
-      comm_start(v_mh_send[i]);
-    }
-
     using param_type = typename Field::param_type;
     param_type param(meta);
     Field buffer_field(param);
 
     CommKey field_dim = {meta.full_dim(0), meta.full_dim(1), meta.full_dim(2), meta.full_dim(3)};
 
-    // Receive cycles
+    // Post all receives up front, so that the transfers proceed while we pack and unpack
     for (int i = 0; i < n_replicates; i++) {
       auto partition_idx
         = coordinate_from_index(i, comm_key); // Here this means which partition of the field we are working on.
@@ -88,31 +119,43 @@ namespace quda
 
       size_t bytes = buffer_field.TotalBytes();
 
-      void *recv_buffer_h = pinned_malloc(bytes);
+      v_recv_buffer_h[i] = pool_pinned_malloc(bytes);
+      v_mh_recv[i] = comm_declare_recv_rank(v_recv_buffer_h[i], src_rank, tag, bytes);
+      comm_start(v_mh_recv[i]);
+    }
+
+    // Send cycles
+    for (int i = 0; i < n_replicates; i++) {
+      auto partition_idx = coordinate_from_index(i, comm_key); // Which partition to send to?
+      auto processor_idx = comm_grid_idx / partition_dim;      // Which processor in that partition to send to?
+
+      auto dst_idx = partition_idx * processor_dim + processor_idx;
+
+      int dst_rank = ::quda::comm_rank_from_coords(dst_idx.data());
+      int tag = rank * total_rank + dst_rank; // tag = src_rank * total_rank + dst_rank
+
+      size_t bytes = meta.TotalBytes();
 
-      auto mh_recv = comm_declare_recv_rank(recv_buffer_h, src_rank, tag, bytes);
+      v_send_buffer_h[i] = pool_pinned_malloc(bytes);
 
-      comm_start(mh_recv);
-      comm_wait(mh_recv);
+      v_base_field[i % n_fields].copy_to_buffer(v_send_buffer_h[i]);
 
-      buffer_field.copy_from_buffer(recv_buffer_h);
+      v_mh_send[i] = comm_declare_send_rank(v_send_buffer_h[i], dst_rank, tag, bytes);
+      comm_start(v_mh_send[i]);
+    }
 
-      comm_free(mh_recv);
-      host_free(recv_buffer_h);
+    // Receive cycles: unpack each partition in completion order, so
+    // the copy of one partition overlaps the transfer of the others
+    split_grid_progress(v_mh_recv, [&](int i) {
+      auto partition_idx = coordinate_from_index(i, comm_key);
+      buffer_field.copy_from_buffer(v_recv_buffer_h[i]);
 
       auto offset = partition_idx * field_dim;
 
       quda::copyFieldOffset(collect_field, buffer_field, offset, pc_type);
-    }
-
-    comm_barrier();
+    });
 
-    for (auto &p : v_send_buffer_h) {
-      if (p) { host_free(p); }
-    };
-    for (auto &p : v_mh_send) {
-      if (p) { comm_free(p); }
-    };
+    split_grid_release(v_mh_send, v_send_buffer_h, v_mh_recv, v_recv_buffer_h);
   }
 
   template <class Field>
@@ -132,6 +175,8 @@ namespace quda
     int n_replicates = product(comm_key);
     std::vector<void *> v_send_buffer_h(n_replicates, nullptr);
     std::vector<MsgHandle *> v_mh_send(n_replicates, nullptr);
+    std::vector<void *> v_recv_buffer_h(n_replicates, nullptr);
+    std::vector<MsgHandle *> v_mh_recv(n_replicates, nullptr);
 
     int n_fields = v_base_field.size();
     if (n_fields == 0) { errorQuda("join_field: output field vec has zero size."); }
@@ -145,6 +190,24 @@ namespace quda
 
     CommKey field_dim = {meta.full_dim(0), meta.full_dim(1), meta.full_dim(2), meta.full_dim(3)};
 
+    // Post all receives up front, so that the transfers proceed while we pack and unpack
+    for (int i = 0; i < n_replicates; i++) {
+
+      auto partition_idx = coordinate_from_index(i, comm_key);
+      auto processor_idx = comm_grid_idx / partition_dim;
+
+      auto src_idx = partition_idx * processor_dim + processor_idx;
+
+      int src_rank = comm_rank_from_coords(src_idx.data());
+      int tag = src_rank * total_rank + rank;
+
+      size_t bytes = buffer_field.TotalBytes();
+
+      v_recv_buffer_h[i] = pool_pinned_malloc(bytes);
+      v_mh_recv[i] = comm_declare_recv_rank(v_recv_buffer_h[i], src_rank, tag, bytes);
+      comm_start(v_mh_recv[i]);
+    }
+
     // Send cycles
     for (int i = 0; i < n_replicates; i++) {
 
@@ -159,7 +222,7 @@ namespace quda
       auto offset = partition_idx * field_dim;
       quda::copyFieldOffset(buffer_field, collect_field, offset, pc_type);
 
-      v_send_buffer_h[i] = pinned_malloc(bytes);
+      v_send_buffer_h[i] = pool_pinned_malloc(bytes);
       buffer_field.copy_to_buffer(v_send_buffer_h[i]);
 
       v_mh_send[i] = comm_declare_send_rank(v_send_buffer_h[i], dst_rank, tag, bytes);
@@ -167,36 +230,15 @@ namespace quda
       comm_start(v_mh_send[i]);
     }
 
-    // Receive cycles
-    for (int i = 0; i < n_replicates; i++) {
-
-      auto partition_idx = coordinate_from_index(i, comm_key);
-      auto processor_idx = comm_grid_idx / partition_dim;
-
-      auto src_idx = partition_idx * processor_dim + processor_idx;
-
-      int src_rank = comm_rank_from_coords(src_idx.data());
-      int tag = src_rank * total_rank + rank;
-
-      size_t bytes = buffer_field.TotalBytes();
-
-      void *recv_buffer_h = pinned_malloc(bytes);
-
-      auto mh_recv = comm_declare_recv_rank(recv_buffer_h, src_rank, tag, bytes);
-
-      comm_start(mh_recv);
-      comm_wait(mh_recv);
-
-      v_base_field[i % n_fields].copy_from_buffer(recv_buffer_h);
-
-      comm_free(mh_recv);
-      host_free(recv_buffer_h);
-    }
-
-    comm_barrier();
+    // Receive cycles: unpack in completion order.  If there are more
+    // replicates than output fields, only the last replicate mapped to
+    // a given field is retained, as if they were received in order.
+    split_grid_progress(v_mh_recv, [&](int i) {
+      if (i + n_fields < n_replicates) return;
+      v_base_field[i % n_fields].copy_from_buffer(v_recv_buffer_h[i]);
+    });
 
-    for (auto &p : v_send_buffer_h) { host_free(p); };
-    for (auto &p : v_mh_send) { comm_free(p); };
+    split_grid_release(v_mh_send, v_send_buffer_h, v_mh_recv, v_recv_buffer_h);
   }
 
 } // namespace quda
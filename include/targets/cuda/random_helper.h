@@ -30,6 +30,28 @@ namespace quda
     curand_init(seed, sequence, offset, &state.state);
   }
 
+  /**
+     @brief Counter-based generator state.  This is only ever held in
+     registers: it is recreated from (seed, sequence, offset) whenever
+     it is needed, so there is no per-site state array.
+   */
+  struct RNGCounterState {
+    curandStatePhilox4_32_10_t state;
+  };
+
+  /**
+   * \brief random init of the counter-based generator, this is O(1)
+   * @param [in] seed -- The RNG seed
+   * @param [in] sequence -- The sequence
+   * @param [in] offset -- the offset
+   * @param [in,out] state - the RNG State
+   */
+  __device__ inline void random_init(unsigned long long seed, unsigned long long sequence, unsigned long long offset,
+                                     RNGCounterState &state)
+  {
+    curand_init(seed, sequence, offset, &state.state);
+  }
+
   template <class Real> struct uniform {
   };
   template <> struct uniform<float> {
@@ -38,7 +60,7 @@ namespace quda
      * \brief Return a uniform deviate between 0 and 1
      * @param [in,out] the RNG State
      */
-    __device__ static inline float rand(RNGState &state) { return curand_uniform(&state.state); }
+    template <typename State> __device__ static inline float rand(State &state) { return curand_uniform(&state.state); }
 
     /**
      * \brief return a uniform deviate between a and b
@@ -46,7 +68,7 @@ namespace quda
      * @param [in] a (the lower end of the range)
      * @param [in] b (the upper end of the range)
      */
-    __device__ static inline float rand(RNGState &state, float a, float b)
+    template <typename State> __device__ static inline float rand(State &state, float a, float b)
     {
       return a + (b - a) * curand_uniform(&state.state);
     }
@@ -57,7 +79,10 @@ namespace quda
      * \brief Return a uniform deviate between 0 and 1
      * @param [in,out] the RNG State
      */
-    __device__ static inline double rand(RNGState &state) { return curand_uniform_double(&state.state); }
+    template <typename State> __device__ static inline double rand(State &state)
+    {
+      return curand_uniform_double(&state.state);
+    }
 
     /**
      * \brief Return a uniform deviate between a and b
@@ -65,7 +90,7 @@ namespace quda
      * @param [in] a -- the lower end of the range
      * @param [in] b -- the high end of the range
      */
-    __device__ static inline double rand(RNGState &state, double a, double b)
+    template <typename State> __device__ static inline double rand(State &state, double a, double b)
     {
       return a + (b - a) * curand_uniform_double(&state.state);
     }
@@ -79,7 +104,7 @@ namespace quda
      * \brief return a gaussian normal deviate with mean of 0
      * @param [in,out] state
      */
-    __device__ static inline float rand(RNGState &state) { return curand_normal(&state.state); }
+    template <typename State> __device__ static inline float rand(State &state) { return curand_normal(&state.state); }
   };
 
   template <> struct normal<double> {
@@ -87,7 +112,10 @@ namespace quda
      * \brief return a gaussian (normal) deviate with a mean of 0
      * @param [in,out] state
      */
-    __device__ static inline double rand(RNGState &state) { return curand_normal_double(&state.state); }
+    template <typename State> __device__ static inline double rand(State &state)
+    {
+      return curand_normal_double(&state.state);
+    }
   };
 
 } // namespace quda
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <sstream>
 #include <tune_quda.h>
 #include <target_device.h>
 #include <lattice_field.h>
@@ -47,11 +48,13 @@ namespace quda
     launch_device(const kernel_t &kernel, const TuneParam &tp, const qudaStream_t &stream, const Arg &arg)
     {
       checkSharedBytes(tp);
+      bool sample = latencySampleStart(stream);
 #ifdef JITIFY
       launch_error = launch_jitify<Functor, grid_stride, Arg>(kernel.name, tp, stream, arg);
 #else
       launch_error = qudaLaunchKernel(kernel.func, tp, stream, static_cast<const void *>(&arg));
 #endif
+      if (sample) latencySampleStop(stream);
       return launch_error;
     }
 
@@ -67,11 +70,15 @@ namespace quda
       checkSharedBytes(tp);
 #ifdef JITIFY
       // note we do the copy to constant memory after the kernel has been compiled in launch_jitify
+      bool sample = latencySampleStart(stream);
       launch_error = launch_jitify<Functor, grid_stride, Arg>(kernel.name, tp, stream, arg);
+      if (sample) latencySampleStop(stream);
 #else
       check_arg_size(arg);
       qudaMemcpyAsync(device::get_constant_buffer<Arg>(), &arg, sizeof(Arg), qudaMemcpyHostToDevice, stream);
+      bool sample = latencySampleStart(stream);
       launch_error = qudaLaunchKernel(kernel.func, tp, stream, static_cast<const void *>(&arg));
+      if (sample) latencySampleStop(stream);
 #endif
       return launch_error;
     }
@@ -109,9 +116,27 @@ namespace quda
       if (this->location == QUDA_CPU_FIELD_LOCATION) strcat(aux, getOmpThreadStr());
     }
 
+    /**
+       @brief Number of loop levels of the host kernel, which bounds
+       the collapse depth explored when tuning host launches.  Zero
+       (the default) means the host launch does not honour
+       TuneParam::host, so there is nothing to tune.
+     */
+    virtual int hostLoopDepth() const { return 0; }
+
     virtual bool advanceTuneParam(TuneParam &param) const override
     {
-      return location == QUDA_CPU_FIELD_LOCATION ? false : Tunable::advanceTuneParam(param);
+      if (location == QUDA_CPU_FIELD_LOCATION)
+        return hostLoopDepth() > 0 ? advanceHostLaunchParam(param.host, hostLoopDepth()) : false;
+      return Tunable::advanceTuneParam(param);
+    }
+
+    virtual std::string paramString(const TuneParam &param) const override
+    {
+      if (location != QUDA_CPU_FIELD_LOCATION) return Tunable::paramString(param);
+      std::stringstream ps;
+      ps << param.host;
+      return ps.str();
     }
 
     TuneKey tuneKey() const override { return TuneKey(vol, typeid(*this).name(), aux); }
@@ -1,31 +1,110 @@
 #pragma once
 
+#include <tune_quda.h>
+#ifdef QUDA_OPENMP
+#include <omp.h>
+#endif
+
 namespace quda
 {
 
-  template <template <typename> class Functor, typename Arg> void Kernel1D_host(const Arg &arg)
+  /**
+     @brief Applies the host launch schedule for the lifetime of the
+     object: sets the OpenMP runtime schedule used by the
+     schedule(runtime) loops below, and restores the caller's schedule
+     on destruction.
+   */
+  class HostLaunchSchedule
+  {
+#ifdef QUDA_OPENMP
+    omp_sched_t saved_kind;
+    int saved_chunk;
+#endif
+
+  public:
+    int threads = 1; /** Number of threads to use for the parallel region */
+
+    /**
+       @param[in] param Host launch parameters
+     */
+    HostLaunchSchedule(const HostLaunchParam &param)
+    {
+#ifdef QUDA_OPENMP
+      constexpr omp_sched_t schedule[] = {omp_sched_static, omp_sched_dynamic, omp_sched_guided};
+      omp_get_schedule(&saved_kind, &saved_chunk);
+      omp_set_schedule(schedule[param.schedule], param.chunk);
+      threads = param.threads > 0 ? param.threads : omp_get_max_threads();
+#endif
+    }
+
+    ~HostLaunchSchedule()
+    {
+#ifdef QUDA_OPENMP
+      omp_set_schedule(saved_kind, saved_chunk);
+#endif
+    }
+
+    HostLaunchSchedule(const HostLaunchSchedule &) = delete;
+    HostLaunchSchedule &operator=(const HostLaunchSchedule &) = delete;
+  };
+
+  template <template <typename> class Functor, typename Arg>
+  void Kernel1D_host(const Arg &arg, const HostLaunchParam &param = HostLaunchParam())
   {
     Functor<Arg> f(const_cast<Arg &>(arg));
-#pragma omp parallel for
+    HostLaunchSchedule schedule(param);
+#pragma omp parallel for schedule(runtime) num_threads(schedule.threads)
     for (int i = 0; i < static_cast<int>(arg.threads.x); i++) { f(i); }
   }
 
-  template <template <typename> class Functor, typename Arg> void Kernel2D_host(const Arg &arg)
+  template <template <typename> class Functor, typename Arg>
+  void Kernel2D_host(const Arg &arg, const HostLaunchParam &param = HostLaunchParam())
   {
     Functor<Arg> f(const_cast<Arg &>(arg));
-#pragma omp parallel for
-    for (int i = 0; i < static_cast<int>(arg.threads.x); i++) {
-      for (int j = 0; j < static_cast<int>(arg.threads.y); j++) { f(i, j); }
+    HostLaunchSchedule schedule(param);
+    const int nx = arg.threads.x;
+    const int ny = arg.threads.y;
+    if (param.collapse >= 2) {
+#pragma omp parallel for collapse(2) schedule(runtime) num_threads(schedule.threads)
+      for (int i = 0; i < nx; i++) {
+        for (int j = 0; j < ny; j++) { f(i, j); }
+      }
+    } else {
+#pragma omp parallel for schedule(runtime) num_threads(schedule.threads)
+      for (int i = 0; i < nx; i++) {
+        for (int j = 0; j < ny; j++) { f(i, j); }
+      }
     }
   }
 
-  template <template <typename> class Functor, typename Arg> void Kernel3D_host(const Arg &arg)
+  template <template <typename> class Functor, typename Arg>
+  void Kernel3D_host(const Arg &arg, const HostLaunchParam &param = HostLaunchParam())
   {
     Functor<Arg> f(const_cast<Arg &>(arg));
-#pragma omp parallel for
-    for (int i = 0; i < static_cast<int>(arg.threads.x); i++) {
-      for (int j = 0; j < static_cast<int>(arg.threads.y); j++) {
-        for (int k = 0; k < static_cast<int>(arg.threads.z); k++) { f(i, j, k); }
+    HostLaunchSchedule schedule(param);
+    const int nx = arg.threads.x;
+    const int ny = arg.threads.y;
+    const int nz = arg.threads.z;
+    if (param.collapse >= 3) {
+#pragma omp parallel for collapse(3) schedule(runtime) num_threads(schedule.threads)
+      for (int i = 0; i < nx; i++) {
+        for (int j = 0; j < ny; j++) {
+          for (int k = 0; k < nz; k++) { f(i, j, k); }
+        }
+      }
+    } else if (param.collapse == 2) {
+#pragma omp parallel for collapse(2) schedule(runtime) num_threads(schedule.threads)
+      for (int i = 0; i < nx; i++) {
+        for (int j = 0; j < ny; j++) {
+          for (int k = 0; k < nz; k++) { f(i, j, k); }
+        }
+      }
+    } else {
+#pragma omp parallel for schedule(runtime) num_threads(schedule.threads)
+      for (int i = 0; i < nx; i++) {
+        for (int j = 0; j < ny; j++) {
+          for (int k = 0; k < nz; k++) { f(i, j, k); }
+        }
       }
     }
   }
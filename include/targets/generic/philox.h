@@ -0,0 +1,151 @@
+/*
+   An implementation of Philox4x32-10 based on constexpr.
+   Original algorithm from
+      John K. Salmon, Mark A. Moraes, Ron O. Dror and David E. Shaw
+      Parallel Random Numbers: As Easy as 1, 2, 3
+      Proceedings of SC11 (2011).
+
+   Philox is a counter-based generator: the n-th output of a stream
+   is a pure function of (key, counter), so a generator can be
+   created in registers for any (seed, sequence, offset) at O(1)
+   cost, and nothing needs to be stored between uses.  The seed and
+   sequence conventions follow those of curand_init for
+   curandStatePhilox4_32_10: the key is the seed, the sequence sets
+   the upper 64 bits of the counter, and the offset (in units of
+   32-bit outputs) advances the lower 64 bits.
+ */
+
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+
+namespace quda
+{
+  namespace target
+  {
+    namespace rng
+    {
+
+      struct Philox4x32 {
+        uint32_t ctr[4] = {};    // 128-bit counter
+        uint32_t key[2] = {};    // 64-bit key
+        uint32_t output[4] = {}; // current block of outputs
+        int idx = 0;             // next output to be consumed from the current block
+      };
+
+      constexpr uint32_t philoxM0 = 0xD2511F53u;
+      constexpr uint32_t philoxM1 = 0xCD9E8D57u;
+      constexpr uint32_t philoxW0 = 0x9E3779B9u;
+      constexpr uint32_t philoxW1 = 0xBB67AE85u;
+      constexpr int philoxRounds = 10;
+
+      constexpr void philox_round(uint32_t ctr[4], const uint32_t key[2])
+      {
+        const uint64_t p0 = static_cast<uint64_t>(philoxM0) * ctr[0];
+        const uint64_t p1 = static_cast<uint64_t>(philoxM1) * ctr[2];
+        const uint32_t hi0 = static_cast<uint32_t>(p0 >> 32u), lo0 = static_cast<uint32_t>(p0);
+        const uint32_t hi1 = static_cast<uint32_t>(p1 >> 32u), lo1 = static_cast<uint32_t>(p1);
+        ctr[0] = hi1 ^ ctr[1] ^ key[0];
+        ctr[1] = lo1;
+        ctr[2] = hi0 ^ ctr[3] ^ key[1];
+        ctr[3] = lo0;
+      }
+
+      /**
+         @brief Compute the block of four outputs for the current counter
+       */
+      constexpr void generate(Philox4x32 &prn)
+      {
+        uint32_t x[4] = {prn.ctr[0], prn.ctr[1], prn.ctr[2], prn.ctr[3]};
+        uint32_t k[2] = {prn.key[0], prn.key[1]};
+        for (int r = 0; r < philoxRounds; r++) {
+          if (r > 0) {
+            k[0] += philoxW0;
+            k[1] += philoxW1;
+          }
+          philox_round(x, k);
+        }
+        for (int i = 0; i < 4; i++) prn.output[i] = x[i];
+      }
+
+      /**
+         @brief Add n to the low 64 bits of the counter, carrying into the high 64 bits
+       */
+      constexpr void increment(Philox4x32 &prn, uint64_t n)
+      {
+        const uint64_t lo = (static_cast<uint64_t>(prn.ctr[1]) << 32u | prn.ctr[0]) + n;
+        const bool carry = lo < n;
+        prn.ctr[0] = static_cast<uint32_t>(lo);
+        prn.ctr[1] = static_cast<uint32_t>(lo >> 32u);
+        if (carry && ++prn.ctr[2] == 0) ++prn.ctr[3];
+      }
+
+      constexpr void skip(Philox4x32 &prn, uint64_t offset)
+      {
+        increment(prn, offset / 4);
+        generate(prn);
+        prn.idx = static_cast<int>(offset % 4);
+      }
+
+      constexpr void seed(Philox4x32 &prn, uint64_t seed, uint64_t subsequence, uint64_t offset = 0)
+      {
+        prn.key[0] = static_cast<uint32_t>(seed);
+        prn.key[1] = static_cast<uint32_t>(seed >> 32u);
+        prn.ctr[0] = 0;
+        prn.ctr[1] = 0;
+        prn.ctr[2] = static_cast<uint32_t>(subsequence);
+        prn.ctr[3] = static_cast<uint32_t>(subsequence >> 32u);
+        skip(prn, offset);
+      }
+
+      /**
+         @brief Return the next 32-bit output of the stream
+       */
+      constexpr uint32_t next(Philox4x32 &prn)
+      {
+        if (prn.idx == 4) {
+          increment(prn, 1);
+          generate(prn);
+          prn.idx = 0;
+        }
+        return prn.output[prn.idx++];
+      }
+
+      /**
+         @brief Return a uniform deviate in the open interval (0, 1)
+       */
+      constexpr double uniform(Philox4x32 &prn)
+      {
+        constexpr double norm = 2.3283064365386963e-10; // 2^-32
+        return (static_cast<double>(next(prn)) + 0.5) * norm;
+      }
+
+      template <typename R> inline void gaussian(Philox4x32 &prn, R &x, R &y)
+      {
+        constexpr R TINY = std::numeric_limits<R>::min();
+        R v, p, r;
+        v = (R)uniform(prn);
+        p = (R)uniform(prn) * (R)2.0 * (R)3.141592653589793238462643383279502884;
+        r = std::sqrt((R)(-2.0) * std::log(v + TINY));
+        x = r * std::sin(p);
+        y = r * std::cos(p);
+      }
+
+      /**
+         @brief Known-answer test from the Random123 distribution: zero counter and key
+       */
+      constexpr bool philox_kat()
+      {
+        Philox4x32 prn;
+        generate(prn);
+        return prn.output[0] == 0x6627e8d5u && prn.output[1] == 0xe169c58du && prn.output[2] == 0xbc57ac4cu
+          && prn.output[3] == 0x9b00dbd8u;
+      }
+
+      static_assert(philox_kat(), "Philox4x32-10 known-answer test failed!");
+
+    } // namespace rng
+  }   // namespace target
+} // namespace quda
@@ -2,6 +2,7 @@
 
 #include <random_quda.h>
 #include <mrg32k3a.h>
+#include <philox.h>
 
 namespace quda
 {
@@ -31,6 +32,35 @@ namespace quda
     state.extd = 0.0;
   }
 
+  /**
+     @brief Counter-based generator state.  This is only ever held in
+     registers: it is recreated from (seed, sequence, offset) whenever
+     it is needed, so there is no per-site state array.
+   */
+  struct RNGCounterState {
+    target::rng::Philox4x32 state;
+    bool has_extf, has_extd;
+    float extf;
+    double extd;
+  };
+
+  /**
+   * \brief random init of the counter-based generator, this is O(1)
+   * @param [in] seed -- The RNG seed
+   * @param [in] sequence -- The sequence
+   * @param [in] offset -- the offset
+   * @param [in,out] state - the RNG State
+   */
+  constexpr void random_init(unsigned long long seed, unsigned long long sequence, unsigned long long offset,
+                             RNGCounterState &state)
+  {
+    target::rng::seed(state.state, seed, sequence, offset);
+    state.has_extf = 0;
+    state.has_extd = 0;
+    state.extf = 0.0f;
+    state.extd = 0.0;
+  }
+
   template <class Real> struct uniform {
   };
 
@@ -40,7 +70,10 @@ namespace quda
      * \brief Return a uniform deviate between 0 and 1
      * @param [in,out] the RNG State
      */
-    static constexpr float rand(RNGState &state) { return (float)target::rng::uniform(state.state); }
+    template <typename State> static constexpr float rand(State &state)
+    {
+      return (float)target::rng::uniform(state.state);
+    }
 
     /**
      * \brief return a uniform deviate between a and b
@@ -48,7 +81,7 @@ namespace quda
      * @param [in] a (the lower end of the range)
      * @param [in] b (the upper end of the range)
      */
-    static constexpr float rand(RNGState &state, float a, float b)
+    template <typename State> static constexpr float rand(State &state, float a, float b)
     {
       return a + (b - a) * (float)target::rng::uniform(state.state);
     }
@@ -59,7 +92,7 @@ namespace quda
      * \brief Return a uniform deviate between 0 and 1
      * @param [in,out] the RNG State
      */
-    static constexpr double rand(RNGState &state) { return target::rng::uniform(state.state); }
+    template <typename State> static constexpr double rand(State &state) { return target::rng::uniform(state.state); }
 
     /**
      * \brief Return a uniform deviate between a and b
@@ -67,7 +100,7 @@ namespace quda
      * @param [in] a -- the lower end of the range
      * @param [in] b -- the high end of the range
      */
-    static constexpr double rand(RNGState &state, double a, double b)
+    template <typename State> static constexpr double rand(State &state, double a, double b)
     {
       return a + (b - a) * target::rng::uniform(state.state);
     }
@@ -81,7 +114,7 @@ namespace quda
      * \brief return a gaussian normal deviate with mean of 0
      * @param [in,out] state
      */
-    static inline float rand(RNGState &state)
+    template <typename State> static inline float rand(State &state)
     {
       if (state.has_extf) {
         state.has_extf = 0;
@@ -101,7 +134,7 @@ namespace quda
      * \brief return a gaussian (normal) deviate with a mean of 0
      * @param [in,out] state
      */
-    static inline double rand(RNGState &state)
+    template <typename State> static inline double rand(State &state)
     {
       if (state.has_extd) {
         state.has_extd = 0;
@@ -1,47 +1,119 @@
 #pragma once
 
 #include <vector>
+#include <algorithm>
+#include <comm_quda.h>
+#ifdef QUDA_OPENMP
+#include <omp.h>
+#endif
 
 namespace quda
 {
 
-  template <template <typename> class Functor, typename Arg> auto Reduction2D_host(const Arg &arg)
+  namespace host
   {
-    using reduce_t = typename Functor<Arg>::reduce_t;
-    Functor<Arg> t(arg);
 
-    reduce_t value = t.init();
-#pragma omp parallel for collapse(2) reduction(Functor <Arg>::apply : value)
-    for (int j = 0; j < static_cast<int>(arg.threads.y); j++) {
-      for (int i = 0; i < static_cast<int>(arg.threads.x); i++) { value = t(value, i, j); }
-    }
+    /**
+       @brief Per-partition partial result, padded and aligned to a
+       cache line so that threads never share a line when updating
+       their partials.
+     */
+    template <typename T> struct alignas(64) partial_t {
+      T value;
+    };
 
-    return value;
-  }
+    /**
+       When deterministic reductions are requested, each slice is
+       partitioned into fixed blocks of this many iterations,
+       independent of the thread count, so that the result is bitwise
+       reproducible.
+     */
+    constexpr int deterministic_block = 1024;
 
-  template <template <typename> class Functor, typename Arg> auto MultiReduction_host(const Arg &arg)
-  {
-#pragma omp declare reduction(multi_reduce                                                                             \
-                              : typename Functor <Arg>::reduce_t                                                       \
-                              : omp_out = Functor <Arg>::apply(omp_out, omp_in))                                       \
-  initializer(omp_priv = Functor <Arg>::init())
+    /**
+       @brief Host reduction engine, used for both single and
+       multi-reductions.  All z slices are processed in a single
+       parallel region: each slice is split into contiguous
+       partitions (one per thread, or fixed-size blocks with
+       comm_deterministic_reduce), every partition is reduced
+       sequentially into its own padded partial, and the partials of
+       each slice are then combined in a fixed pairwise tree order.
+       @tparam Functor The functor that defines the reduction
+       @tparam multi Whether the functor takes a z index (multi-reduction)
+       @param[in] arg Kernel argument struct
+       @return Vector of arg.threads.z reduced values
+     */
+    template <template <typename> class Functor, bool multi, typename Arg>
+    auto reduce(const Arg &arg)
+    {
+      using reduce_t = typename Functor<Arg>::reduce_t;
+      Functor<Arg> t(arg);
+
+      const int nx = arg.threads.x;
+      const int nz = multi ? arg.threads.z : 1;
+      const int64_t n = static_cast<int64_t>(nx) * arg.threads.y;
+
+#ifdef QUDA_OPENMP
+      const int n_thread = omp_get_max_threads();
+#else
+      const int n_thread = 1;
+#endif
+      int n_part = comm_deterministic_reduce() ? (n + deterministic_block - 1) / deterministic_block : n_thread;
+      n_part = std::max(1, static_cast<int>(std::min(static_cast<int64_t>(n_part), n)));
+
+      std::vector<partial_t<reduce_t>> partial(static_cast<size_t>(nz) * n_part);
+      std::vector<reduce_t> value(nz);
 
-    using reduce_t = typename Functor<Arg>::reduce_t;
-    Functor<Arg> t(arg);
+#pragma omp parallel num_threads(n_thread)
+      {
+#pragma omp for schedule(static)
+        for (int p = 0; p < nz * n_part; p++) {
+          const int k = p / n_part;
+          const int m = p % n_part;
+          const int64_t begin = n * m / n_part;
+          const int64_t end = n * (m + 1) / n_part;
 
-    std::vector<reduce_t> value(arg.threads.z, t.init());
-    for (int k = 0; k < static_cast<int>(arg.threads.z); k++) {
-      auto val = t.init();
+          auto val = t.init();
+          int j = begin < end ? begin / nx : 0;
+          int i = begin < end ? begin % nx : 0;
+          for (int64_t idx = begin; idx < end; idx++) {
+            if constexpr (multi)
+              val = t(val, i, j, k);
+            else
+              val = t(val, i, j);
+            if (++i == nx) {
+              i = 0;
+              j++;
+            }
+          }
+          partial[p].value = val;
+        }
 
-#pragma omp parallel for collapse(2) reduction(multi_reduce : val)
-      for (int j = 0; j < static_cast<int>(arg.threads.y); j++) {
-        for (int i = 0; i < static_cast<int>(arg.threads.x); i++) { val = t(val, i, j, k); }
+        // combine the partials of each slice in a fixed tree order
+#pragma omp for schedule(static)
+        for (int k = 0; k < nz; k++) {
+          auto *part = &partial[static_cast<size_t>(k) * n_part];
+          for (int stride = 1; stride < n_part; stride *= 2) {
+            for (int m = 0; m + stride < n_part; m += 2 * stride)
+              part[m].value = Functor<Arg>::apply(part[m].value, part[m + stride].value);
+          }
+          value[k] = part[0].value;
+        }
       }
 
-      value[k] = val;
+      return value;
     }
 
-    return value;
+  } // namespace host
+
+  template <template <typename> class Functor, typename Arg> auto Reduction2D_host(const Arg &arg)
+  {
+    return host::reduce<Functor, false>(arg)[0];
+  }
+
+  template <template <typename> class Functor, typename Arg> auto MultiReduction_host(const Arg &arg)
+  {
+    return host::reduce<Functor, true>(arg);
   }
 
 } // namespace quda
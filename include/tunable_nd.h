@@ -24,6 +24,8 @@ namespace quda
     */
     virtual bool tuneGridDim() const { return grid_stride; }
 
+    int hostLoopDepth() const override { return 1; }
+
     /**
        @brief Launch kernel on the device performing the operation
        defined in the functor.
@@ -47,9 +49,9 @@ namespace quda
        @param[in] arg Kernel argument struct
      */
     template <template <typename> class Functor, typename Arg>
-    void launch_host(const TuneParam &, const qudaStream_t &, const Arg &arg)
+    void launch_host(const TuneParam &tp, const qudaStream_t &, const Arg &arg)
     {
-      Kernel1D_host<Functor, Arg>(arg);
+      Kernel1D_host<Functor, Arg>(arg, tp.host);
     }
 
     /**
@@ -172,6 +174,8 @@ namespace quda
     mutable unsigned int step_y_bkup;
     bool tune_block_x;
 
+    int hostLoopDepth() const override { return 2; }
+
     /**
        @brief Launch kernel on the device performing the operation
        defined in the functor.
@@ -196,10 +200,10 @@ namespace quda
        @param[in] arg Kernel argument struct
      */
     template <template <typename> class Functor, typename Arg>
-    void launch_host(const TuneParam &, const qudaStream_t &, const Arg &arg)
+    void launch_host(const TuneParam &tp, const qudaStream_t &, const Arg &arg)
     {
       const_cast<Arg &>(arg).threads.y = vector_length_y;
-      Kernel2D_host<Functor, Arg>(arg);
+      Kernel2D_host<Functor, Arg>(arg, tp.host);
     }
 
     /**
@@ -426,6 +430,8 @@ namespace quda
     mutable unsigned step_z_bkup;
     bool tune_block_y;
 
+    int hostLoopDepth() const override { return 3; }
+
     /**
        @brief Launch kernel on the device performing the operation
        defined in the functor.
@@ -451,11 +457,11 @@ namespace quda
        @param[in] arg Kernel argument struct
      */
     template <template <typename> class Functor, typename Arg>
-    void launch_host(const TuneParam &, const qudaStream_t &, const Arg &arg)
+    void launch_host(const TuneParam &tp, const qudaStream_t &, const Arg &arg)
     {
       const_cast<Arg &>(arg).threads.y = vector_length_y;
       const_cast<Arg &>(arg).threads.z = vector_length_z;
-      Kernel3D_host<Functor, Arg>(arg);
+      Kernel3D_host<Functor, Arg>(arg, tp.host);
     }
 
     /**
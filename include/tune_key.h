@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstdint>
 #include <cstring>
 #include <ostream>
 
@@ -41,6 +42,31 @@ namespace quda {
       return false;
     }
 
+    bool operator==(const TuneKey &other) const
+    {
+      return std::strcmp(volume, other.volume) == 0 && std::strcmp(name, other.name) == 0
+        && std::strcmp(aux, other.aux) == 0;
+    }
+
+    /**
+       @brief FNV-1a hash over the three null-terminated key strings.
+       This is computed on demand, since the strings are regularly
+       modified in place (e.g., strcat to aux) after construction.
+     */
+    std::size_t hash() const
+    {
+      uint64_t h = 14695981039346656037ull;
+      for (const char *s : {volume, name, aux}) {
+        for (; *s; s++) h = (h ^ static_cast<unsigned char>(*s)) * 1099511628211ull;
+        h = (h ^ 0xff) * 1099511628211ull; // separator so that fields cannot alias
+      }
+      return static_cast<std::size_t>(h);
+    }
+
+    struct Hash {
+      std::size_t operator()(const TuneKey &key) const { return key.hash(); }
+    };
+
     friend std::ostream &operator<<(std::ostream &output, const TuneKey &key)
     {
       output << "volume = " << key.volume << ", ";
@@ -9,6 +9,7 @@
 #include <iomanip>
 #include <typeinfo>
 #include <map>
+#include <unordered_map>
 
 #include <tune_key.h>
 #include <quda_internal.h>
@@ -17,16 +18,45 @@
 
 namespace quda {
 
+  /**
+     @brief Launch schedule for host (CPU-location) kernels.  This is
+     autotuned and stored in the tunecache alongside the device launch
+     parameters, and the default corresponds to a plain static OpenMP
+     loop over the outermost index.
+   */
+  struct HostLaunchParam {
+    int threads = 0;  /** Number of OpenMP threads (0 = all available) */
+    int chunk = 0;    /** Iterations per scheduling chunk (0 = OpenMP default) */
+    int collapse = 1; /** Number of loop levels collapsed into the parallel loop */
+    int schedule = 0; /** OpenMP schedule: 0 = static, 1 = dynamic, 2 = guided */
+  };
+
+  std::ostream &operator<<(std::ostream &, const HostLaunchParam &);
+
+  /**
+     @brief Advance the host launch schedule to the next candidate
+     during autotuning.  We step through chunk size, schedule,
+     collapse depth and then thread count (halving from the maximum).
+     @param[in,out] param The host launch parameters
+     @param[in] loop_depth Number of loop levels the kernel has (maximum collapse depth)
+     @return Whether there is a further candidate (false once reset to the default)
+   */
+  bool advanceHostLaunchParam(HostLaunchParam &param, int loop_depth);
+
   struct TuneParam {
     dim3 block = {1, 1, 1};
     dim3 grid;
     unsigned int shared_bytes = 0;
     bool set_max_shared_bytes = false; // whether to opt in to max shared bytes per thread block
     int4 aux = {1, 1, 1, 1};           // free parameter used as an arbitrary autotuning dimension
+    HostLaunchParam host;              // launch schedule used when running on the host
 
     std::string comment;
     float time = FLT_MAX;
     long long n_calls = 0;
+    long long flops = 0; // flops per call, as last reported by the kernel (profile only)
+    long long bytes = 0; // bytes per call, as last reported by the kernel (profile only)
+    int trace_id = -1;   // interned trace key, set on the first traced launch
 
     TuneParam();
     TuneParam(const TuneParam &) = default;
@@ -37,11 +67,17 @@ namespace quda {
 
   std::ostream &operator<<(std::ostream &, const TuneParam &);
 
+  /**
+     Hashed tunecache storage: lookups on the launch path are O(1).
+     Use TuneKey::operator< to obtain a stable ordering if required.
+   */
+  using tunecache_t = std::unordered_map<TuneKey, TuneParam, TuneKey::Hash>;
+
   /**
    * @brief Returns a reference to the tunecache map
    * @return tunecache reference
    */
-  const std::map<TuneKey, TuneParam> &getTuneCache();
+  const tunecache_t &getTuneCache();
 
   /**
      @brief Return a string encoding the QUDA version
@@ -419,11 +455,59 @@ namespace quda {
    */
   TuneParam tuneLaunch(Tunable &tunable, QudaTune enabled = getTuning(), QudaVerbosity verbosity = getVerbosity());
 
+  /**
+   * @brief Start timing a kernel launch into the latency profile
+   * (QUDA_ENABLE_LATENCY_PROFILE=1), if the preceding tuneLaunch on
+   * this thread selected it for sampling.  Called by the kernel
+   * launchers immediately before the launch.
+   * @param[in] stream The stream the kernel is launched on
+   * @return Whether the launch is being sampled, in which case
+   * latencySampleStop must be called after it
+   */
+  bool latencySampleStart(const qudaStream_t &stream);
+
+  /**
+   * @brief Stop timing the sampled kernel launch.  The sample is added
+   * to the profile once it has completed on the device.
+   * @param[in] stream The stream the kernel was launched on
+   */
+  void latencySampleStop(const qudaStream_t &stream);
+
   /**
    * @brief Post an event in the trace, recording where it was posted
    */
   void postTrace_(const char *func, const char *file, int line);
 
+  /**
+   * @brief Convert a binary trace stream, as written by each rank when
+   * QUDA_ENABLE_TRACE is set, to the Chrome/Perfetto trace event json
+   * format.  Kernels are shown with their tuned duration at the host
+   * time they were launched.
+   * @param[in] trace_path The binary trace stream
+   * @param[in] json_path The json file to write
+   * @param[in] pid Process id to assign to the events (e.g., the rank)
+   * @param[in] origin Wall-clock time, in ns since the Unix epoch, that
+   * the event times are given relative to.  Use a common origin to
+   * align the traces of different ranks.
+   */
+  void convertTraceToChrome(const std::string &trace_path, const std::string &json_path, int pid = 0,
+                            int64_t origin = 0);
+
+  /**
+   * @brief Return the wall-clock time at which the timestamps of a
+   * binary trace stream start
+   * @param[in] trace_path The binary trace stream
+   * @return Base of the timestamps in ns since the Unix epoch
+   */
+  int64_t traceStreamBase(const std::string &trace_path);
+
+  /**
+   * @brief Flush this rank's trace stream and convert it to
+   * [<QUDA_PROFILE_OUTPUT_BASE>_]trace_rank<r>.json alongside it.
+   * Called once by every rank from endQuda.
+   */
+  void saveTrace();
+
   /**
    * @brief Enable the profile kernel counting
    */
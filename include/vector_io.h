@@ -1,5 +1,6 @@
 #pragma once
 
+#include <memory>
 #include <string>
 #include <color_spinor_field.h>
 #include <reference_wrapper_helper.h>
@@ -10,12 +11,31 @@ namespace quda
   /**
      @brief VectorIO is a simple wrapper class for loading and saving
      sets of vector fields using QIO.
+
+     Vectors are transferred in chunks of chunk_size vectors, with
+     each chunk written as a separate QIO record, so that at most
+     async_depth + 2 chunks are staged in host memory at once.  When
+     MPI provides MPI_THREAD_MULTIPLE, the file is read or written by
+     a worker thread that owns the QIO handle and communicates on a
+     private communicator, while the calling thread converts vectors
+     to and from the staging buffers: save_async returns once the last
+     chunk has been staged, and prefetch returns immediately, leaving
+     the transfer to overlap with the caller until wait or load.
+     Otherwise the same chunks are transferred on the calling thread.
+     QIO keeps the lattice layout in global state, so only one
+     transfer may be outstanding across all VectorIO instances, and no
+     other QIO file may be accessed meanwhile.
    */
   class VectorIO
   {
     const std::string filename;
     bool parity_inflate;
     bool partfile;
+    uint32_t chunk_size;
+    uint32_t async_depth;
+
+    struct Pipeline;
+    std::unique_ptr<Pipeline> pipeline; /** Outstanding prefetch or save_async */
 
   public:
     /**
@@ -24,22 +44,68 @@ namespace quda
        @param[in] parity_inflate Whether to inflate single_parity
        field to dual parity fields for I/O
        @param[in] partfile Whether or not to save in partfiles (ignored on load)
+       @param[in] chunk_size Number of vectors per QIO record when
+       saving, and so the number of vectors staged at once (0 = all
+       vectors in a single record, the legacy format, which every
+       version of the reader accepts)
+       @param[in] async_depth Number of records that may be queued
+       between the calling thread and the worker thread
+    */
+    VectorIO(const std::string &filename, bool parity_inflate = false, bool partfile = false, uint32_t chunk_size = 8,
+             uint32_t async_depth = 2);
+
+    /**
+       Destructor for VectorIO class: completes any outstanding save
+       and discards any unconsumed prefetch
     */
-    VectorIO(const std::string &filename, bool parity_inflate = false, bool partfile = false);
+    ~VectorIO();
 
     /**
-       @brief Load vectors from filename
+       @brief Load vectors from filename, converting each record while
+       the next ones are read.  If a matching prefetch is outstanding,
+       the load continues from it.
        @param[in] vecs The set of vectors to load
     */
     void load(cvector_ref<ColorSpinorField> &vecs);
 
     /**
-       @brief Save vectors to filename
+       @brief Start reading filename on the worker thread, which reads
+       up to async_depth records ahead of a subsequent call to load
+       with the same vector geometry.  Without a worker thread this
+       only records the geometry.
+       @param[in] vecs Vectors describing the geometry of the
+       subsequent load (their contents are not accessed)
+    */
+    void prefetch(cvector_ref<const ColorSpinorField> &vecs);
+
+    /**
+       @brief Save vectors to filename, returning once the file is
+       complete
        @param[in] vecs The set of vectors to save
        @param[in] prec Optional change of precision when saving
        @param[in] size Optional cap to number of vectors saved
     */
     void save(cvector_ref<const ColorSpinorField> &vecs, QudaPrecision prec = QUDA_INVALID_PRECISION, uint32_t size = 0);
+
+    /**
+       @brief Save vectors to filename on the worker thread.  This
+       returns once every chunk has been staged to host memory, so
+       that vecs may be modified or freed immediately, with up to
+       async_depth records still being written.  The file is only
+       complete once wait has returned.
+       @param[in] vecs The set of vectors to save
+       @param[in] prec Optional change of precision when saving
+       @param[in] size Optional cap to number of vectors saved
+    */
+    void save_async(cvector_ref<const ColorSpinorField> &vecs, QudaPrecision prec = QUDA_INVALID_PRECISION,
+                    uint32_t size = 0);
+
+    /**
+       @brief Wait for an outstanding save_async to complete the file.
+       An outstanding prefetch that has not been consumed by load is
+       read to the end (the reads are collective) and discarded.
+    */
+    void wait();
   };
 
 } // namespace quda
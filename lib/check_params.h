@@ -256,6 +256,34 @@ void printQudaEigParam(QudaEigParam *param) {
   P(io_parity_inflate, QUDA_BOOLEAN_INVALID);
 #endif
 
+#if defined INIT_PARAM
+  for (int i = 0; i < QUDA_MAX_DIM; i++) P(compress_block_size[i], i < 4 ? 4 : 1);
+  P(compress_n_basis, 0);
+  P(compress_precision, QUDA_HALF_PRECISION);
+#else
+  for (int i = 0; i < QUDA_MAX_DIM; i++) P(compress_block_size[i], INVALID_INT);
+  P(compress_n_basis, INVALID_INT);
+  P(compress_precision, QUDA_INVALID_PRECISION);
+#endif
+
+#ifdef INIT_PARAM
+  P(compress_bytes, 0.0);
+  P(compress_full_bytes, 0.0);
+#elif defined(PRINT_PARAM)
+  P(compress_bytes, INVALID_DOUBLE);
+  P(compress_full_bytes, INVALID_DOUBLE);
+#endif
+
+#if defined INIT_PARAM
+  ret.checkpoint_file[0] = '\0';
+  P(checkpoint_interval, 1);
+#else
+#if defined PRINT_PARAM
+  printfQuda("checkpoint_file = %s\n", param->checkpoint_file);
+#endif
+  P(checkpoint_interval, INVALID_INT);
+#endif
+
 #ifdef INIT_PARAM
   return ret;
 #endif
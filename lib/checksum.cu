@@ -18,14 +18,23 @@ namespace quda {
     return u.checksum(); 
   }
 
+  /**
+     Since XOR is associative and commutative, the checksum is
+     independent of the order in which the links are visited, so we
+     can stream over the flattened (parity, x_cb) index in parallel,
+     with each thread (and SIMD lane) accumulating a private partial.
+   */
   template <typename Arg>
   uint64_t ChecksumCPU(const Arg &arg)
   {
     uint64_t checksum_ = 0;
-    for (int parity=0; parity<2; parity++)
-      for (int x_cb=0; x_cb<arg.volumeCB; x_cb++)
-	for (int d=0; d<arg.U.geometry; d++)
-	  checksum_ ^= siteChecksum(arg, d, parity, x_cb);
+    const int64_t n = 2 * static_cast<int64_t>(arg.volumeCB);
+#pragma omp parallel for simd schedule(static) reduction(^ : checksum_)
+    for (int64_t i = 0; i < n; i++) {
+      const int parity = i / arg.volumeCB;
+      const int x_cb = i % arg.volumeCB;
+      for (int d = 0; d < arg.U.geometry; d++) checksum_ ^= siteChecksum(arg, d, parity, x_cb);
+    }
     return checksum_;
   }
 
@@ -35,6 +35,26 @@ namespace quda
     bool custom;
   };
 
+  struct ReduceHandle_s {
+    /**
+       The request of the in-flight MPI_Iallreduce
+     */
+    MPI_Request request;
+
+    /**
+       The array being reduced in place
+     */
+    double *data;
+
+    size_t size;
+
+    /**
+       The pre-rounded components being reduced when deterministic
+       reductions are enabled, empty otherwise
+     */
+    std::vector<double> bins;
+  };
+
   Communicator::Communicator(int nDim, const int *commDims, QudaCommsMap rank_from_coords, void *map_data,
                              bool user_set_comm_handle_, void *user_comm)
   {
@@ -278,17 +298,54 @@ namespace quda
       MPI_CHECK(MPI_Allreduce(data, recvbuf.data(), size, MPI_DOUBLE, MPI_SUM, MPI_COMM_HANDLE));
       memcpy(data, recvbuf.data(), size * sizeof(double));
     } else {
-      size_t n = comm_size();
-      std::vector<double> recv_buf(size * n);
-      MPI_CHECK(MPI_Allgather(data, size, MPI_DOUBLE, recv_buf.data(), size, MPI_DOUBLE, MPI_COMM_HANDLE));
+      auto rh = comm_allreduce_sum_array_start(data, size);
+      comm_allreduce_wait(rh);
+    }
+  }
 
-      std::vector<double> recv_trans(size * n);
-      for (size_t i = 0; i < n; i++) {
-        for (size_t j = 0; j < size; j++) { recv_trans[j * n + i] = recv_buf[i * size + j]; }
+  ReduceHandle *Communicator::comm_allreduce_sum_array_start(double *data, size_t size)
+  {
+    auto rh = new ReduceHandle;
+    rh->data = data;
+    rh->size = size;
+
+    if (comm_deterministic_reduce()) {
+      // reduce the maximum magnitudes first to fix the binning grid, then
+      // the pre-rounded components, whose sum is exact in any order
+      std::vector<double> max(size);
+      for (size_t i = 0; i < size; i++) max[i] = std::fabs(data[i]);
+      std::vector<double> recv_max(size);
+      MPI_CHECK(MPI_Allreduce(max.data(), recv_max.data(), size, MPI_DOUBLE, MPI_MAX, MPI_COMM_HANDLE));
+
+      // non-finite results are reproducible anyway, so use the plain sum
+      if (std::all_of(recv_max.begin(), recv_max.end(), [](double m) { return std::isfinite(m); })) {
+        rh->bins.resize(size * binned_folds);
+        binned_split(rh->bins.data(), data, recv_max.data(), size);
+        MPI_CHECK(MPI_Iallreduce(MPI_IN_PLACE, rh->bins.data(), rh->bins.size(), MPI_DOUBLE, MPI_SUM, MPI_COMM_HANDLE,
+                                 &rh->request));
+        return rh;
       }
+    }
 
-      for (size_t i = 0; i < size; i++) { data[i] = deterministic_reduce(recv_trans.data() + i * n, n); }
+    MPI_CHECK(MPI_Iallreduce(MPI_IN_PLACE, data, size, MPI_DOUBLE, MPI_SUM, MPI_COMM_HANDLE, &rh->request));
+    return rh;
+  }
+
+  bool Communicator::comm_allreduce_test(ReduceHandle *rh)
+  {
+    int flag = 0;
+    MPI_CHECK(MPI_Test(&rh->request, &flag, MPI_STATUS_IGNORE));
+    return flag;
+  }
+
+  void Communicator::comm_allreduce_wait(ReduceHandle *&rh)
+  {
+    MPI_CHECK(MPI_Wait(&rh->request, MPI_STATUS_IGNORE));
+    if (rh->bins.size()) {
+      for (size_t i = 0; i < rh->size; i++) rh->data[i] = binned_sum(rh->bins.data() + i * binned_folds);
     }
+    delete rh;
+    rh = nullptr;
   }
 
   void Communicator::comm_allreduce_sum(size_t &a)
@@ -2,6 +2,7 @@
 #include <map>
 #include <array.h>
 #include <lattice_field.h>
+#include <gauge_field.h>
 
 namespace quda
 {
@@ -58,6 +59,7 @@ namespace quda
     }
 
     LatticeField::freeGhostBuffer(); // Destroy the (IPC) Comm buffers with the old communicator.
+    GaugeField::freeExtendedGhostBuffer(); // host extended-ghost message handles are tied to the old communicator
 
     current_key = split_key;
   }
@@ -194,6 +196,23 @@ namespace quda
     get_current_communicator().comm_allreduce_sum_array(data, size);
   }
 
+  ReduceHandle *comm_allreduce_sum_array_start(double *data, size_t size)
+  {
+    return get_current_communicator().comm_allreduce_sum_array_start(data, size);
+  }
+
+  bool comm_allreduce_test(ReduceHandle *rh)
+  {
+    if (rh == nullptr) errorQuda("null reduce handle");
+    return get_current_communicator().comm_allreduce_test(rh);
+  }
+
+  void comm_allreduce_wait(ReduceHandle *&rh)
+  {
+    if (rh == nullptr) errorQuda("null reduce handle");
+    get_current_communicator().comm_allreduce_wait(rh);
+  }
+
   template <> void comm_allreduce_sum<std::vector<double>>(std::vector<double> &a)
   {
     comm_allreduce_sum_array(a.data(), a.size());
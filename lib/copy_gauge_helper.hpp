@@ -31,6 +31,7 @@ namespace quda
       strcat(aux, ",");
       strcat(aux, out.AuxString().c_str());
       if (Arg::fine_grain) strcat(aux, ",fine-grained");
+      if (location == QUDA_CPU_FIELD_LOCATION && !Arg::fine_grain) strcat(aux, ",tiled");
     }
 
     void set_ghost(int is_ghost_)
@@ -54,10 +55,15 @@ namespace quda
       TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity());
       arg.threads.x = size;
       constexpr bool enable_host = true;
-      if (!is_ghost)
+      if (!is_ghost && !Arg::fine_grain && location == QUDA_CPU_FIELD_LOCATION) {
+        constexpr int tile = CopyGaugeTiled_<Arg>::tile;
+        arg.threads.x = (size + tile - 1) / tile;
+        launch_host<CopyGaugeTiled_>(tp, stream, arg);
+      } else if (!is_ghost) {
         launch<CopyGauge_, enable_host>(tp, stream, arg);
-      else
+      } else {
         launch<CopyGhost_, enable_host>(tp, stream, arg);
+      }
     }
 
     TuneKey tuneKey() const override
@@ -200,7 +200,17 @@ namespace quda {
       if (!checkParam(tp)) errorQuda("Invalid launch param");
 
       if (out.Location() == QUDA_CPU_FIELD_LOCATION) {
-        errorQuda("Not enabled");
+        if constexpr (std::is_same_v<Float, yFloat> && std::is_same_v<Float, ghostFloat>) {
+          if (out.FieldOrder() != QUDA_SPACE_SPIN_COLOR_FIELD_ORDER)
+            errorQuda("Unsupported field order %d", out.FieldOrder());
+          if (Y.FieldOrder() != QUDA_QDP_GAUGE_ORDER || X.FieldOrder() != QUDA_QDP_GAUGE_ORDER)
+            errorQuda("Unsupported gauge field order Y = %d, X = %d", Y.FieldOrder(), X.FieldOrder());
+          // each host thread computes all colors and dimensions of a site, so no color or dimension splitting
+          launch_host<CoarseDslash>(tp, stream, Arg<1, 1, false>(out, inA, inB, Y, X, (Float)kappa, parity, halo));
+        } else {
+          errorQuda("Mixed precision (Y precision %d, halo precision %d) not supported on the host", Y.Precision(),
+                    halo.GhostPrecision());
+        }
       } else {
         checkNative(out[0], inA[0], inB[0], Y, X);
 
@@ -754,7 +764,7 @@ namespace quda {
 
       // before we do policy tuning we must ensure the kernel
       // constituents have been tuned since we can't do nested tuning
-      if (!tuned()) {
+      if (dslash.Y.Location() == QUDA_CUDA_FIELD_LOCATION && !tuned()) {
         disableProfileCount();
 	for (auto &i : policies) if(i!= DslashCoarsePolicy::DSLASH_COARSE_POLICY_DISABLED) dslash(i);
 	enableProfileCount();
@@ -766,6 +776,12 @@ namespace quda {
 
    inline void apply(const qudaStream_t &)
    {
+     if (dslash.Y.Location() == QUDA_CPU_FIELD_LOCATION) {
+       // the host halo exchange ignores the pack and halo locations, so all policies are equivalent
+       dslash(DslashCoarsePolicy::DSLASH_COARSE_BASIC);
+       return;
+     }
+
      TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity());
 
      if (tp.aux.x >= (int)policies.size()) errorQuda("Requested policy that is outside of range");
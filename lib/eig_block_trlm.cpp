@@ -86,6 +86,19 @@ namespace quda
 
     // Print Eigensolver params
     printEigensolverSetup();
+
+    // Resume from a checkpoint of an earlier run with the same parameters
+    std::vector<double> state;
+    if (loadCheckpoint(kSpace[0], state)) {
+      if (state.size() != 1 + alpha.size() + 2 * block_alpha.size() + 2 * block_beta.size())
+        errorQuda("Unexpected BLOCK TRLM checkpoint state size %lu", state.size());
+      auto it = state.begin();
+      mat_norm = *it++;
+      for (auto &a : alpha) a = *it++;
+      for (auto &a : block_alpha) { a = Complex(it[0], it[1]); it += 2; }
+      for (auto &b : block_beta) { b = Complex(it[0], it[1]); it += 2; }
+      loadCheckpointVectors({kSpace.begin(), kSpace.begin() + num_keep + block_size});
+    }
     //---------------------------------------------------------------------------
 
     // Begin BLOCK TRLM Eigensolver computation
@@ -175,6 +188,17 @@ namespace quda
       // Check for convergence
       if (num_converged >= n_conv) converged = true;
       restart_iter++;
+
+      if (!converged) {
+        // the kept Ritz vectors, the residual block and the block arrow matrix carry the state to the next restart
+        state.assign(1, mat_norm);
+        state.insert(state.end(), alpha.begin(), alpha.end());
+        for (auto &a : block_alpha) state.insert(state.end(), {a.real(), a.imag()});
+        for (auto &b : block_beta) state.insert(state.end(), {b.real(), b.imag()});
+        getProfile().TPSTOP(QUDA_PROFILE_COMPUTE);
+        saveCheckpoint({kSpace.begin(), kSpace.begin() + num_keep + block_size}, state);
+        getProfile().TPSTART(QUDA_PROFILE_COMPUTE);
+      }
     }
 
     getProfile().TPSTOP(QUDA_PROFILE_COMPUTE);
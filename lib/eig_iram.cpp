@@ -459,6 +459,23 @@ namespace quda
 
     // Loop over restart iterations.
     num_keep = 0;
+
+    // Resume from a checkpoint of an earlier run with the same parameters
+    std::vector<double> state;
+    if (loadCheckpoint(kSpace[0], state)) {
+      if (state.size() != 2 * static_cast<size_t>(n_kr * n_kr))
+        errorQuda("Unexpected IRAM checkpoint state size %lu", state.size());
+      auto it = state.begin();
+      for (auto &row : upperHess)
+        for (auto &h : row) {
+          h = Complex(it[0], it[1]);
+          it += 2;
+        }
+      vector_ref<ColorSpinorField> vecs {kSpace.begin(), kSpace.begin() + num_keep};
+      vecs.push_back(r[0]);
+      loadCheckpointVectors(vecs);
+    }
+
     while (restart_iter < max_restarts && !converged) {
       for (int step = num_keep; step < n_kr; step++) arnoldiStep(kSpace, r, beta, step);
       iter += n_kr - num_keep;
@@ -538,6 +555,18 @@ namespace quda
         if (sqrt(blas::norm2(r[0])) < epsilon) { errorQuda("IRAM has encountered an invariant subspace..."); }
       }
       restart_iter++;
+
+      if (!converged) {
+        // the compressed Krylov space, the residual and the upper Hessenberg matrix carry the state to the next restart
+        state.clear();
+        for (auto &row : upperHess)
+          for (auto &h : row) state.insert(state.end(), {h.real(), h.imag()});
+        vector_ref<const ColorSpinorField> vecs {kSpace.begin(), kSpace.begin() + num_keep};
+        vecs.push_back(r[0]);
+        getProfile().TPSTOP(QUDA_PROFILE_COMPUTE);
+        saveCheckpoint(vecs, state);
+        getProfile().TPSTART(QUDA_PROFILE_COMPUTE);
+      }
     }
 
     getProfile().TPSTOP(QUDA_PROFILE_COMPUTE);
@@ -67,6 +67,17 @@ namespace quda
 
     // Print Eigensolver params
     printEigensolverSetup();
+
+    // Resume from a checkpoint of an earlier run with the same parameters
+    std::vector<double> state;
+    if (loadCheckpoint(kSpace[0], state)) {
+      if (state.size() != 1 + alpha.size() + beta.size())
+        errorQuda("Unexpected TRLM checkpoint state size %lu", state.size());
+      mat_norm = state[0];
+      std::copy(state.begin() + 1, state.begin() + 1 + alpha.size(), alpha.begin());
+      std::copy(state.begin() + 1 + alpha.size(), state.end(), beta.begin());
+      loadCheckpointVectors({kSpace.begin(), kSpace.begin() + num_keep + 1});
+    }
     //---------------------------------------------------------------------------
 
     // Begin TRLM Eigensolver computation
@@ -152,6 +163,16 @@ namespace quda
       }
 
       restart_iter++;
+
+      if (!converged) {
+        // the kept Ritz vectors, the residual vector and the arrow matrix carry the state to the next restart
+        state.assign(1, mat_norm);
+        state.insert(state.end(), alpha.begin(), alpha.end());
+        state.insert(state.end(), beta.begin(), beta.end());
+        getProfile().TPSTOP(QUDA_PROFILE_COMPUTE);
+        saveCheckpoint({kSpace.begin(), kSpace.begin() + num_keep + 1}, state);
+        getProfile().TPSTART(QUDA_PROFILE_COMPUTE);
+      }
     }
 
     getProfile().TPSTOP(QUDA_PROFILE_COMPUTE);
@@ -2,6 +2,8 @@
 #include <stdlib.h>
 #include <math.h>
 #include <iostream>
+#include <fstream>
+#include <sstream>
 #include <vector>
 #include <algorithm>
 #include <cfloat>
@@ -20,6 +22,52 @@
 namespace quda
 {
 
+  namespace
+  {
+    constexpr const char *checkpoint_tag = "quda_eig_checkpoint";
+    constexpr int checkpoint_version = 1;
+
+    std::string checkpointMetaPath(const QudaEigParam &param) { return std::string(param.checkpoint_file) + ".meta"; }
+
+    std::string checkpointVectorPath(const QudaEigParam &param, int slot)
+    {
+      return std::string(param.checkpoint_file) + ".vec" + std::to_string(slot);
+    }
+
+    /**
+       @brief The parameters that define the Krylov space, all of
+       which must match for a checkpoint to be resumed.  The operator
+       itself cannot be checked, so it is the user's responsibility to
+       resume with the same gauge field and Dirac parameters.
+    */
+    std::string checkpointHeader(const QudaEigParam &param, const ColorSpinorField &meta, int block_size)
+    {
+      std::stringstream ss;
+      ss.precision(17);
+      ss << checkpoint_tag << " " << checkpoint_version << "\n";
+      ss << "eig_type " << param.eig_type << "\n";
+      ss << "spectrum " << param.spectrum << "\n";
+      ss << "n_ev " << param.n_ev << "\n";
+      ss << "n_kr " << param.n_kr << "\n";
+      ss << "n_conv " << param.n_conv << "\n";
+      ss << "block_size " << block_size << "\n";
+      ss << "tol " << param.tol << "\n";
+      ss << "use_pc " << param.use_pc << "\n";
+      ss << "use_norm_op " << param.use_norm_op << "\n";
+      ss << "use_dagger " << param.use_dagger << "\n";
+      ss << "compute_gamma5 " << param.compute_gamma5 << "\n";
+      ss << "use_poly_acc " << param.use_poly_acc << "\n";
+      ss << "poly_deg " << param.poly_deg << "\n";
+      ss << "a_min " << param.a_min << "\n";
+      ss << "lattice";
+      for (int d = 0; d < meta.Ndim(); d++) ss << " " << meta.X(d) * comm_dim(d);
+      ss << "\n";
+      ss << "site_subset " << meta.SiteSubset() << "\n";
+      ss << "precision " << meta.Precision() << "\n";
+      return ss.str();
+    }
+  } // namespace
+
   // Eigensolver class
   //-----------------------------------------------------------------------------
   EigenSolver::EigenSolver(const DiracMatrix &mat, QudaEigParam *eig_param) : mat(mat), eig_param(eig_param)
@@ -56,6 +104,8 @@ namespace quda
     if (n_conv == 0) errorQuda("n_conv=0 passed to Eigensolver");
     if (n_ev_deflate > n_conv) errorQuda("deflation vecs = %d is greater than n_conv = %d", n_ev_deflate, n_conv);
     if (ortho_block_size < 0) errorQuda("block_size=%d must be positive or zero", ortho_block_size);
+    if (eig_param->compute_evals_batch_size <= 0)
+      errorQuda("compute_evals_batch_size=%d must be positive", eig_param->compute_evals_batch_size);
 
     residua.resize(n_kr, 0.0);
 
@@ -85,6 +135,19 @@ namespace quda
     // underlying operators (M, Mdag) is computed.
     compute_svd = eig_param->compute_svd;
 
+    // Local-coherence compression of the converged eigenvectors
+    eig_param->compress_bytes = 0.0;
+    eig_param->compress_full_bytes = 0.0;
+    if (eig_param->compress_n_basis > 0) {
+      if (compute_svd) errorQuda("Eigenvector compression is not supported with the SVD");
+      if (eig_param->preserve_deflation) errorQuda("Eigenvector compression is not supported with preserve_deflation");
+      if (eig_param->compress_n_basis > n_conv)
+        errorQuda("compress_n_basis = %d is greater than n_conv = %d", eig_param->compress_n_basis, n_conv);
+      for (int d = 0; d < 4; d++)
+        if (eig_param->compress_block_size[d] <= 0)
+          errorQuda("compress_block_size[%d] = %d must be positive", d, eig_param->compress_block_size[d]);
+    }
+
     getProfile().TPSTOP(QUDA_PROFILE_INIT);
   }
 
@@ -239,21 +302,316 @@ namespace quda
     evals.resize(n_conv);
 
     // Only save if outfile is defined
+    std::unique_ptr<VectorIO> io;
     if (strcmp(eig_param->vec_outfile, "") != 0) {
       logQuda(QUDA_SUMMARIZE, "saving eigenvectors\n");
       const QudaParity mat_parity = impliedParityFromMatPC(mat.getMatPCType());
       for (auto &k : kSpace) k.setSuggestedParity(mat_parity);
 
-      // save the required eigenvectors or right singular vectors to file
-      VectorIO io(eig_param->vec_outfile, eig_param->io_parity_inflate == QUDA_BOOLEAN_TRUE, eig_param->partfile);
-      io.save(kSpace, save_prec, n_conv);
+      // save the required eigenvectors or right singular vectors to file, overlapping the write with what follows
+      io = std::make_unique<VectorIO>(eig_param->vec_outfile, eig_param->io_parity_inflate == QUDA_BOOLEAN_TRUE,
+                                      eig_param->partfile);
+      io->save_async(kSpace, save_prec, n_conv);
     }
 
+    // compress after staging, so that the files always hold the full eigenvectors
+    if (eig_param->compress_n_basis > 0) compressEigenvectors(kSpace);
+
+    completeCheckpoint();
+    if (converged) removeCheckpoint();
+    if (io) io->wait();
+
     logQuda(QUDA_SUMMARIZE, "********************************\n");
     logQuda(QUDA_SUMMARIZE, "***** END QUDA EIGENSOLVER *****\n");
     logQuda(QUDA_SUMMARIZE, "********************************\n");
   }
 
+  void EigenSolver::saveCheckpoint(cvector_ref<const ColorSpinorField> &vecs, const std::vector<double> &state)
+  {
+    if (strcmp(eig_param->checkpoint_file, "") == 0) return;
+    if (eig_param->checkpoint_interval <= 0 || restart_iter % eig_param->checkpoint_interval != 0) return;
+
+    // the previous checkpoint must be complete before its slot becomes the fallback
+    completeCheckpoint();
+
+    getProfile().TPSTART(QUDA_PROFILE_IO);
+
+    // write the vectors to the slot not used by the last complete checkpoint
+    const int slot = 1 - checkpoint_slot;
+    checkpoint_io = std::make_unique<VectorIO>(checkpointVectorPath(*eig_param, slot), false, eig_param->partfile);
+    checkpoint_io->save_async(vecs);
+
+    if (comm_rank() == 0) {
+      std::stringstream ss;
+      ss.precision(17);
+      ss << checkpointHeader(*eig_param, vecs[0], block_size);
+      ss << "slot " << slot << "\n";
+      ss << "n_vec " << vecs.size() << "\n";
+      ss << "restart_iter " << restart_iter << "\n";
+      ss << "iter " << iter << "\n";
+      ss << "num_converged " << num_converged << "\n";
+      ss << "num_locked " << num_locked << "\n";
+      ss << "num_keep " << num_keep << "\n";
+      ss << "a_max " << eig_param->a_max << "\n";
+      ss << "residua " << residua.size();
+      for (auto res : residua) ss << " " << res;
+      ss << "\nstate " << state.size();
+      for (auto x : state) ss << " " << x;
+      ss << "\n";
+      checkpoint_meta = ss.str();
+    }
+
+    logQuda(QUDA_VERBOSE, "Checkpointing eigensolver state at restart %d\n", restart_iter);
+
+    getProfile().TPSTOP(QUDA_PROFILE_IO);
+  }
+
+  void EigenSolver::completeCheckpoint()
+  {
+    if (!checkpoint_io) return;
+
+    getProfile().TPSTART(QUDA_PROFILE_IO);
+    checkpoint_io->wait();
+    checkpoint_io.reset();
+    comm_barrier();
+
+    if (comm_rank() == 0) {
+      // write to a temporary and rename, so that the metadata always refers to complete vectors
+      const std::string path = checkpointMetaPath(*eig_param);
+      const std::string tmp_path = path + ".tmp";
+      std::ofstream out(tmp_path.c_str());
+      out << checkpoint_meta;
+      out.close();
+      if (!out || rename(tmp_path.c_str(), path.c_str())) {
+        warningQuda("Unable to write eigensolver checkpoint %s", path.c_str());
+        remove(tmp_path.c_str());
+      }
+    }
+
+    checkpoint_slot = 1 - checkpoint_slot;
+    logQuda(QUDA_VERBOSE, "Committed eigensolver checkpoint to slot %d\n", checkpoint_slot);
+
+    getProfile().TPSTOP(QUDA_PROFILE_IO);
+  }
+
+  bool EigenSolver::loadCheckpoint(const ColorSpinorField &meta, std::vector<double> &state)
+  {
+    if (strcmp(eig_param->checkpoint_file, "") == 0) return false;
+
+    getProfile().TPSTART(QUDA_PROFILE_IO);
+    const std::string path = checkpointMetaPath(*eig_param);
+
+    // read on the first rank and broadcast
+    std::string contents;
+    size_t size = 0;
+    if (comm_rank() == 0) {
+      std::ifstream in(path.c_str());
+      if (in) {
+        std::stringstream ss;
+        ss << in.rdbuf();
+        contents = ss.str();
+      }
+      size = contents.size();
+    }
+    comm_broadcast(&size, sizeof(size), 0);
+    contents.resize(size);
+    if (size > 0) comm_broadcast(contents.data(), size, 0);
+
+    bool restored = false;
+    const std::string header = checkpointHeader(*eig_param, meta, block_size);
+    if (size == 0) {
+      logQuda(QUDA_VERBOSE, "No eigensolver checkpoint %s found\n", path.c_str());
+    } else if (contents.compare(0, header.size(), header) != 0) {
+      warningQuda("Eigensolver checkpoint %s does not match the current parameters, starting from scratch",
+                  path.c_str());
+    } else {
+      std::stringstream ss(contents.substr(header.size()));
+      std::string key;
+      auto expect = [&](const char *name) {
+        ss >> key;
+        if (!ss || key != name) errorQuda("Bad format in %s, expected %s", path.c_str(), name);
+      };
+
+      int slot = 0;
+      size_t n_vec = 0;
+      int restart = 0;
+      expect("slot");
+      ss >> slot;
+      expect("n_vec");
+      ss >> n_vec;
+      expect("restart_iter");
+      ss >> restart;
+      if (!ss) errorQuda("Bad format in %s", path.c_str());
+
+      // a checkpoint left by a run that exhausted its restarts would leave nothing to do
+      if (restart >= max_restarts) {
+        warningQuda("Eigensolver checkpoint %s was written at restart %d, not below max_restarts = %d, starting from "
+                    "scratch",
+                    path.c_str(), restart, max_restarts);
+        getProfile().TPSTOP(QUDA_PROFILE_IO);
+        return false;
+      }
+      checkpoint_slot = slot;
+      checkpoint_n_vec = n_vec;
+      restart_iter = restart;
+
+      expect("iter");
+      ss >> iter;
+      expect("num_converged");
+      ss >> num_converged;
+      expect("num_locked");
+      ss >> num_locked;
+      expect("num_keep");
+      ss >> num_keep;
+      expect("a_max");
+      ss >> eig_param->a_max;
+
+      size_t n = 0;
+      expect("residua");
+      ss >> n;
+      if (n != residua.size())
+        errorQuda("Checkpoint %s has %lu residua, expected %lu", path.c_str(), n, residua.size());
+      for (auto &res : residua) ss >> res;
+
+      expect("state");
+      ss >> n;
+      state.resize(n);
+      for (auto &x : state) ss >> x;
+      if (!ss) errorQuda("Bad format in %s", path.c_str());
+
+      logQuda(QUDA_SUMMARIZE, "Resuming eigensolver from checkpoint %s at restart %d with %d converged\n",
+              path.c_str(), restart_iter, num_converged);
+      restored = true;
+    }
+
+    getProfile().TPSTOP(QUDA_PROFILE_IO);
+    return restored;
+  }
+
+  void EigenSolver::loadCheckpointVectors(cvector_ref<ColorSpinorField> &vecs)
+  {
+    if (vecs.size() != checkpoint_n_vec)
+      errorQuda("Checkpoint holds %lu vectors, expected %lu", checkpoint_n_vec, vecs.size());
+
+    getProfile().TPSTART(QUDA_PROFILE_IO);
+    VectorIO io(checkpointVectorPath(*eig_param, checkpoint_slot));
+    io.load(vecs);
+    getProfile().TPSTOP(QUDA_PROFILE_IO);
+  }
+
+  void EigenSolver::removeCheckpoint()
+  {
+    if (strcmp(eig_param->checkpoint_file, "") == 0) return;
+
+    // remove the metadata first, so that an interrupted removal never leaves a checkpoint without its vectors
+    const std::string meta_path = checkpointMetaPath(*eig_param);
+    if (comm_rank() == 0) {
+      remove(meta_path.c_str());
+      remove((meta_path + ".tmp").c_str());
+    }
+    comm_barrier();
+
+    for (int slot = 0; slot < 2; slot++) {
+      const std::string path = checkpointVectorPath(*eig_param, slot);
+      if (eig_param->partfile == QUDA_BOOLEAN_TRUE) {
+        // QIO writes one volume file per rank
+        char suffix[16];
+        snprintf(suffix, sizeof(suffix), ".vol%04d", comm_rank());
+        remove((path + suffix).c_str());
+      } else if (comm_rank() == 0) {
+        remove(path.c_str());
+      }
+    }
+    comm_barrier();
+  }
+
+  void EigenSolver::compressEigenvectors(std::vector<ColorSpinorField> &kSpace)
+  {
+    const int n_basis = eig_param->compress_n_basis;
+    kSpace.resize(n_conv); // drop any workspace beyond the converged eigenvectors
+    const ColorSpinorField &meta = kSpace[0];
+    if (meta.Ndim() > 4) errorQuda("Eigenvector compression not supported for %d-d fields", meta.Ndim());
+
+    // the transfer operator works at single or double precision
+    const QudaPrecision prec = std::max(meta.Precision(), QUDA_SINGLE_PRECISION);
+    const QudaParity parity = impliedParityFromMatPC(mat.getMatPCType());
+    const bool single_parity = meta.SiteSubset() == QUDA_PARITY_SITE_SUBSET;
+
+    // the block basis is defined on the full lattice, with single-parity eigenvectors embedded in their parity
+    ColorSpinorParam param(meta);
+    param.create = QUDA_ZERO_FIELD_CREATE;
+    param.setPrecision(prec, QUDA_INVALID_PRECISION, true);
+    if (single_parity) {
+      param.siteSubset = QUDA_FULL_SITE_SUBSET;
+      param.x[0] *= 2;
+    }
+    resize(compress_basis, n_basis, param);
+    for (int i = 0; i < n_basis; i++) {
+      if (single_parity)
+        compress_basis[i][parity] = kSpace[i];
+      else
+        compress_basis[i] = kSpace[i];
+    }
+
+    int geo_bs[QUDA_MAX_DIM];
+    for (int d = 0; d < QUDA_MAX_DIM; d++) geo_bs[d] = eig_param->compress_block_size[d];
+    const int spin_bs = meta.Nspin() == 4 ? 2 : meta.Nspin() == 2 ? 1 : 0;
+
+    compress_transfer = std::make_unique<Transfer>(compress_basis, n_basis, 1, true, geo_bs, spin_bs, prec,
+                                                   QUDA_TRANSFER_AGGREGATE);
+    if (single_parity) compress_transfer->setSiteSubset(QUDA_PARITY_SITE_SUBSET, parity);
+
+    // the basis has been absorbed into the block-orthonormal prolongator
+    compress_basis.resize(1);
+
+    compress_fine_param = ColorSpinorParam(meta);
+    compress_fine_param.create = QUDA_NULL_FIELD_CREATE;
+    compress_fine_param.setPrecision(prec, QUDA_INVALID_PRECISION, true);
+
+    // geo_bs now holds the block size actually used by the transfer operator
+    compress_coarse_param = ColorSpinorParam(compress_basis[0].create_coarse(geo_bs, spin_bs, n_basis, prec));
+    compress_coarse_param.create = QUDA_NULL_FIELD_CREATE;
+
+    ColorSpinorParam store_param(compress_coarse_param);
+    store_param.setPrecision(eig_param->compress_precision, QUDA_INVALID_PRECISION, true);
+
+    // restrict in batches, releasing the full eigenvectors as we go so the footprint is never doubled
+    const size_t full_bytes = kSpace.size() * meta.Bytes();
+    const int batch_size = eig_param->compute_evals_batch_size;
+    std::vector<ColorSpinorField> coeffs, tmp;
+    resize(coeffs, kSpace.size(), store_param);
+    resize(tmp, batch_size, compress_coarse_param);
+
+    for (auto i = 0u; i < kSpace.size(); i += batch_size) {
+      auto n = std::min(static_cast<size_t>(batch_size), kSpace.size() - i);
+      compress_transfer->R({tmp.begin(), tmp.begin() + n}, {kSpace.begin() + i, kSpace.begin() + i + n});
+      blas::copy({coeffs.begin() + i, coeffs.begin() + i + n}, {tmp.begin(), tmp.begin() + n});
+      for (auto j = i; j < i + n; j++) kSpace[j] = ColorSpinorField();
+    }
+
+    kSpace = std::move(coeffs);
+
+    const size_t compressed_bytes = kSpace.size() * kSpace[0].Bytes() + compress_transfer->Vectors().Bytes();
+    eig_param->compress_bytes = compressed_bytes;
+    eig_param->compress_full_bytes = full_bytes;
+    logQuda(QUDA_SUMMARIZE, "Compressed %lu eigenvectors with a %d vector block basis: %.3f GiB -> %.3f GiB\n",
+            kSpace.size(), n_basis, full_bytes / static_cast<double>(1 << 30),
+            compressed_bytes / static_cast<double>(1 << 30));
+  }
+
+  void EigenSolver::decompress(cvector_ref<ColorSpinorField> &out, cvector_ref<const ColorSpinorField> &in) const
+  {
+    if (!compressed()) errorQuda("Eigenvectors have not been compressed");
+
+    std::vector<ColorSpinorField> fine, coarse;
+    resize(fine, in.size(), compress_fine_param);
+    resize(coarse, in.size(), compress_coarse_param);
+
+    blas::copy(coarse, in);
+    compress_transfer->P(fine, coarse);
+    blas::copy(out, fine);
+  }
+
   void EigenSolver::chebyOp(cvector_ref<ColorSpinorField> &out,
                             cvector_ref<const ColorSpinorField> &in)
   {
@@ -580,6 +938,8 @@ namespace quda
   void EigenSolver::computeEvals(std::vector<ColorSpinorField> &evecs,
                                  std::vector<Complex> &evals, int size)
   {
+    if (compressed()) errorQuda("Cannot compute eigenvalues from compressed eigenvectors");
+
     auto batch_size = eig_param->compute_evals_batch_size;
 
     if (size > static_cast<int>(evecs.size()))
@@ -639,6 +999,34 @@ namespace quda
     // Perform Sum_i V_i * (L_i)^{-1} * (V_i)^dag * vec = vec_defl
     // for all i computed eigenvectors and values.
 
+    if (compressed()) {
+      // With compressed eigenvectors V_i = P c_i, and since P is
+      // block orthonormal, (V_i)^dag * vec = (c_i)^dag * R * vec, so
+      // the deflation is carried out on the coarse coefficients and
+      // only the result is prolongated.
+      std::vector<ColorSpinorField> fine, coarse;
+      resize(fine, src.size(), compress_fine_param);
+      resize(coarse, src.size(), compress_coarse_param);
+
+      blas::copy(fine, src);
+      compress_transfer->R(coarse, fine);
+
+      std::vector<Complex> s(n_defl * src.size());
+      blas::block::cDotProduct(s, {evecs.begin(), evecs.begin() + n_defl}, coarse);
+      for (auto j = 0u; j < src.size(); j++)
+        for (int i = 0; i < n_defl; i++) { s[i * src.size() + j] /= evals[i].real(); }
+
+      blas::zero(coarse);
+      blas::block::caxpy(s, {evecs.begin(), evecs.begin() + n_defl}, coarse);
+      compress_transfer->P(fine, coarse);
+
+      if (accumulate)
+        blas::xpy(fine, sol);
+      else
+        blas::copy(sol, fine);
+      return;
+    }
+
     // 1. Take block inner product: (V_i)^dag * vec = A_i
     std::vector<Complex> s(n_defl * src.size());
     blas::block::cDotProduct(s, {evecs.begin(), evecs.begin() + n_defl}, {src.begin(), src.end()});
@@ -671,6 +1059,8 @@ namespace quda
 
     // Error estimates (residua) given by ||A*vec - lambda*vec||
     computeEvals(kSpace, evals);
+
+    if (eig_param->compress_n_basis > 0) compressEigenvectors(kSpace);
   }
 
   void EigenSolver::sortArrays(QudaEigSpectrumType spec_type, int n, std::vector<Complex> &x, std::vector<Complex> &y)
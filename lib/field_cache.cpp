@@ -1,21 +1,94 @@
+#include <algorithm>
+#include <cstdlib>
 #include <field_cache.h>
 #include <color_spinor_field.h>
 
 namespace quda {
 
-  template <typename T> std::map<FieldKey<T>, std::stack<T>> FieldTmp<T>::cache;
+  template <typename T> std::map<FieldKey<T>, typename FieldTmp<T>::CacheEntry> FieldTmp<T>::cache;
+  template <typename T> std::list<FieldKey<T>> FieldTmp<T>::lru;
+  template <typename T> std::map<FieldKey<T>, FieldCacheStats> FieldTmp<T>::stats;
+  template <typename T> size_t FieldTmp<T>::cache_bytes = 0;
+  template <typename T> size_t FieldTmp<T>::cache_bytes_peak = 0;
 
-  template <typename T> FieldTmp<T>::FieldTmp(const T &a) : key(FieldKey(a))
+  template <typename T> size_t FieldTmp<T>::max_bytes()
+  {
+    static bool init = false;
+    static size_t max = 0;
+
+    if (!init) {
+      char *max_str = getenv("QUDA_FIELD_CACHE_MAX_MB");
+      if (max_str) {
+        long mb = atol(max_str);
+        if (mb < 0) errorQuda("QUDA_FIELD_CACHE_MAX_MB=%ld cannot be negative", mb);
+        max = static_cast<size_t>(mb) << 20;
+        logQuda(QUDA_SUMMARIZE, "QUDA_FIELD_CACHE_MAX_MB set to %ld\n", mb);
+      }
+      init = true;
+    }
+
+    return max;
+  }
+
+  template <typename T> typename FieldTmp<T>::CacheEntry &FieldTmp<T>::touch(const FieldKey<T> &key)
   {
     auto it = cache.find(key);
+    if (it == cache.end()) {
+      it = cache.emplace(key, CacheEntry()).first;
+      it->second.lru_entry = lru.insert(lru.end(), key);
+    } else {
+      lru.splice(lru.end(), lru, it->second.lru_entry);
+    }
+    return it->second;
+  }
+
+  template <typename T> void FieldTmp<T>::evict()
+  {
+    auto max = max_bytes();
+    if (max == 0) return;
+
+    // evict from the least-recently-used keys until we fit within budget
+    for (auto it = lru.begin(); cache_bytes > max && it != lru.end();) {
+      auto &entry = cache[*it];
+      auto &key_stats = stats[*it];
+      while (cache_bytes > max && entry.fields.size()) {
+        cache_bytes -= key_stats.bytes;
+        key_stats.evictions++;
+        entry.fields.pop();
+      }
+      if (entry.fields.size() == 0) {
+        cache.erase(*it);
+        it = lru.erase(it);
+      } else {
+        it++;
+      }
+    }
+  }
+
+  template <typename T> bool FieldTmp<T>::acquire()
+  {
+    auto &entry = touch(key);
+    auto &key_stats = stats[key];
+
+    if (entry.fields.size()) { // found an entry
+      tmp = std::move(entry.fields.top());
+      entry.fields.pop(); // pop the defunct object
+      cache_bytes -= key_stats.bytes;
+      key_stats.hits++;
+      return true;
+    }
+
+    key_stats.misses++;
+    return false;
+  }
 
-    if (it != cache.end() && it->second.size()) { // found an entry
-      tmp = std::move(it->second.top());
-      it->second.pop(); // pop the defunct object
-    } else { // no entry found, we must allocate a new field
+  template <typename T> FieldTmp<T>::FieldTmp(const T &a) : key(FieldKey(a))
+  {
+    if (!acquire()) { // no entry found, we must allocate a new field
       typename T::param_type param(a);
       param.create = QUDA_ZERO_FIELD_CREATE;
       tmp = T(param);
+      stats[key].bytes = tmp.Bytes();
     }
 
     if constexpr (std::is_same_v<T, ColorSpinorField>) {
@@ -25,13 +98,9 @@ namespace quda {
 
   template <typename T> FieldTmp<T>::FieldTmp(const FieldKey<T> &key, const typename T::param_type &param) : key(key)
   {
-    auto it = cache.find(key);
-
-    if (it != cache.end() && it->second.size()) { // found an entry
-      tmp = std::move(it->second.top());
-      it->second.pop(); // pop the defunct object
-    } else {            // no entry found, we must allocate a new field
+    if (!acquire()) { // no entry found, we must allocate a new field
       tmp = T(param);
+      stats[key].bytes = tmp.Bytes();
     }
   }
 
@@ -39,12 +108,42 @@ namespace quda {
   {
     // don't cache the field if it's empty (e.g., has been moved)
     if (tmp.Bytes() == 0) return;
-    cache[key].push(std::move(tmp));
+    stats[key].bytes = tmp.Bytes();
+    touch(key).fields.push(std::move(tmp));
+    cache_bytes += stats[key].bytes;
+    cache_bytes_peak = std::max(cache_bytes, cache_bytes_peak);
+    evict();
   }
 
   template <typename T> void FieldTmp<T>::destroy()
   {
     cache.clear();
+    lru.clear();
+    cache_bytes = 0;
+  }
+
+  template <typename T> void FieldTmp<T>::print_stats()
+  {
+    uint64_t hits = 0, misses = 0, evictions = 0;
+    for (auto &s : stats) {
+      hits += s.second.hits;
+      misses += s.second.misses;
+      evictions += s.second.evictions;
+    }
+    if (hits + misses == 0) return;
+
+    printfQuda("Field cache: %lu hits, %lu misses, %lu evictions, peak cached = %.3f MiB, budget = %.3f MiB\n", hits,
+               misses, evictions, cache_bytes_peak / static_cast<double>(1 << 20),
+               max_bytes() / static_cast<double>(1 << 20));
+    if (getVerbosity() >= QUDA_VERBOSE) {
+      for (auto &s : stats) {
+        // bytes saved is the allocation traffic that was served from the cache
+        printfQuda("  %s %s: %lu hits, %lu misses, %lu evictions, %.3f MiB per field, %.3f MiB saved\n",
+                   s.first.volume.c_str(), s.first.aux.c_str(), s.second.hits, s.second.misses, s.second.evictions,
+                   s.second.bytes / static_cast<double>(1 << 20),
+                   s.second.hits * s.second.bytes / static_cast<double>(1 << 20));
+      }
+    }
   }
 
   template class FieldTmp<ColorSpinorField>;
@@ -1,4 +1,6 @@
 #include <typeinfo>
+#include <array>
+#include <map>
 #include <gauge_field.h>
 #include <blas_quda.h>
 #include <timer.h>
@@ -678,6 +680,78 @@ namespace quda {
     }
   }
 
+  namespace
+  {
+
+    /**
+       Persistent host buffers and message handles for the host
+       extended-ghost exchange of a given face geometry.  Index [d][0]
+       is the backwards face and [d][1] the forwards face.
+     */
+    struct ExtendedGhostBuffer {
+      std::array<void *, QUDA_MAX_DIM> send = {};
+      std::array<void *, QUDA_MAX_DIM> recv = {};
+      std::array<std::array<MsgHandle *, 2>, QUDA_MAX_DIM> mh_send = {};
+      std::array<std::array<MsgHandle *, 2>, QUDA_MAX_DIM> mh_recv = {};
+    };
+
+    /**
+       The key is the per-dimension face size (zero if the dimension is
+       not exchanged) and the partitioning, since the latter determines
+       which message handles exist.
+     */
+    using ExtendedGhostKey = std::pair<std::array<size_t, QUDA_MAX_DIM>, int>;
+
+    std::map<ExtendedGhostKey, ExtendedGhostBuffer> extended_ghost_buffer;
+
+    ExtendedGhostBuffer &getExtendedGhostBuffer(const std::array<size_t, QUDA_MAX_DIM> &bytes)
+    {
+      int partitioned = 0;
+      for (int d = 0; d < QUDA_MAX_DIM; d++) partitioned |= (comm_dim_partitioned(d) ? 1 : 0) << d;
+
+      ExtendedGhostKey key(bytes, partitioned);
+      auto it = extended_ghost_buffer.find(key);
+      if (it != extended_ghost_buffer.end()) return it->second;
+
+      ExtendedGhostBuffer &buffer = extended_ghost_buffer[key];
+      for (int d = 0; d < QUDA_MAX_DIM; d++) {
+        if (!bytes[d]) continue;
+        buffer.send[d] = safe_malloc(2 * bytes[d]);
+        buffer.recv[d] = safe_malloc(2 * bytes[d]);
+
+        if (comm_dim_partitioned(d)) {
+          buffer.mh_recv[d][0] = comm_declare_receive_relative(buffer.recv[d], d, -1, bytes[d]);
+          buffer.mh_recv[d][1] = comm_declare_receive_relative(static_cast<char *>(buffer.recv[d]) + bytes[d], d, +1,
+                                                               bytes[d]);
+          buffer.mh_send[d][0] = comm_declare_send_relative(buffer.send[d], d, -1, bytes[d]);
+          buffer.mh_send[d][1] = comm_declare_send_relative(static_cast<char *>(buffer.send[d]) + bytes[d], d, +1,
+                                                            bytes[d]);
+        }
+      }
+      logQuda(QUDA_DEBUG_VERBOSE, "Created extended ghost buffer %lu for partitioning %d\n",
+              extended_ghost_buffer.size(), partitioned);
+
+      return buffer;
+    }
+
+  } // namespace
+
+  void GaugeField::freeExtendedGhostBuffer()
+  {
+    for (auto &entry : extended_ghost_buffer) {
+      auto &buffer = entry.second;
+      for (int d = 0; d < QUDA_MAX_DIM; d++) {
+        for (int dir = 0; dir < 2; dir++) {
+          if (buffer.mh_send[d][dir]) comm_free(buffer.mh_send[d][dir]);
+          if (buffer.mh_recv[d][dir]) comm_free(buffer.mh_recv[d][dir]);
+        }
+        if (buffer.send[d]) host_free(buffer.send[d]);
+        if (buffer.recv[d]) host_free(buffer.recv[d]);
+      }
+    }
+    extended_ghost_buffer.clear();
+  }
+
   void GaugeField::exchangeExtendedGhost(const lat_dim_t &R, bool no_comms_fill)
   {
     if (location == QUDA_CUDA_FIELD_LOCATION) {
@@ -747,61 +821,43 @@ namespace quda {
       bufferIndex = 1 - bufferIndex;
       qudaDeviceSynchronize();
     } else {
-      void *send[QUDA_MAX_DIM];
-      void *recv[QUDA_MAX_DIM];
-      size_t bytes[QUDA_MAX_DIM];
+      std::array<size_t, QUDA_MAX_DIM> bytes = {};
       // store both parities and directions in each
       for (int d = 0; d < nDim; d++) {
         if (!(comm_dim_partitioned(d) || (no_comms_fill && R[d]))) continue;
         bytes[d] = surface[d] * R[d] * geometry * nInternal * precision;
-        send[d] = safe_malloc(2 * bytes[d]);
-        recv[d] = safe_malloc(2 * bytes[d]);
       }
+      auto &buffer = getExtendedGhostBuffer(bytes);
 
+      // the receives are independent of the corner fill, so post them all up front
       for (int d = 0; d < nDim; d++) {
-        if (!(comm_dim_partitioned(d) || (no_comms_fill && R[d]))) continue;
+        if (!comm_dim_partitioned(d) || !bytes[d]) continue;
+        comm_start(buffer.mh_recv[d][0]);
+        comm_start(buffer.mh_recv[d][1]);
+      }
+
+      // the sends must remain sequential in dimension since dimension d
+      // must be injected before dimension d+1 is extracted to fill the corners
+      for (int d = 0; d < nDim; d++) {
+        if (!bytes[d]) continue;
         // extract into a contiguous buffer
-        extractExtendedGaugeGhost(*this, d, R, send, true);
+        extractExtendedGaugeGhost(*this, d, R, buffer.send.data(), true);
 
         if (comm_dim_partitioned(d)) {
-          // do the exchange
-          MsgHandle *mh_recv_back;
-          MsgHandle *mh_recv_fwd;
-          MsgHandle *mh_send_fwd;
-          MsgHandle *mh_send_back;
-
-          mh_recv_back = comm_declare_receive_relative(recv[d], d, -1, bytes[d]);
-          mh_recv_fwd = comm_declare_receive_relative(((char *)recv[d]) + bytes[d], d, +1, bytes[d]);
-          mh_send_back = comm_declare_send_relative(send[d], d, -1, bytes[d]);
-          mh_send_fwd = comm_declare_send_relative(((char *)send[d]) + bytes[d], d, +1, bytes[d]);
-
-          comm_start(mh_recv_back);
-          comm_start(mh_recv_fwd);
-          comm_start(mh_send_fwd);
-          comm_start(mh_send_back);
-
-          comm_wait(mh_send_fwd);
-          comm_wait(mh_send_back);
-          comm_wait(mh_recv_back);
-          comm_wait(mh_recv_fwd);
-
-          comm_free(mh_send_fwd);
-          comm_free(mh_send_back);
-          comm_free(mh_recv_back);
-          comm_free(mh_recv_fwd);
+          comm_start(buffer.mh_send[d][1]);
+          comm_start(buffer.mh_send[d][0]);
+
+          comm_wait(buffer.mh_send[d][1]);
+          comm_wait(buffer.mh_send[d][0]);
+          comm_wait(buffer.mh_recv[d][0]);
+          comm_wait(buffer.mh_recv[d][1]);
         } else {
-          memcpy(static_cast<char *>(recv[d]) + bytes[d], send[d], bytes[d]);
-          memcpy(recv[d], static_cast<char *>(send[d]) + bytes[d], bytes[d]);
+          memcpy(static_cast<char *>(buffer.recv[d]) + bytes[d], buffer.send[d], bytes[d]);
+          memcpy(buffer.recv[d], static_cast<char *>(buffer.send[d]) + bytes[d], bytes[d]);
         }
 
         // inject back into the gauge field
-        extractExtendedGaugeGhost(*this, d, R, recv, false);
-      }
-
-      for (int d = 0; d < nDim; d++) {
-        if (!(comm_dim_partitioned(d) || (no_comms_fill && R[d]))) continue;
-        host_free(send[d]);
-        host_free(recv[d]);
+        extractExtendedGaugeGhost(*this, d, R, buffer.recv.data(), false);
       }
     }
   }
@@ -35,9 +35,9 @@ namespace quda {
     {
       TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity());
       if (type == QUDA_NOISE_UNIFORM)
-        launch<NoiseGauge>(tp, stream, GaugeNoiseArg<real, nColor, QUDA_NOISE_UNIFORM>(U, rng.State()));
+        launch<NoiseGauge>(tp, stream, GaugeNoiseArg<real, nColor, QUDA_NOISE_UNIFORM>(U, rng.Accessor()));
       else
-        launch<NoiseGauge>(tp, stream, GaugeNoiseArg<real, nColor, QUDA_NOISE_GAUSS>(U, rng.State()));
+        launch<NoiseGauge>(tp, stream, GaugeNoiseArg<real, nColor, QUDA_NOISE_GAUSS>(U, rng.Accessor()));
         
     }
 
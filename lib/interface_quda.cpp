@@ -2,7 +2,12 @@
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
+#include <condition_variable>
+#include <functional>
 #include <iostream>
+#include <map>
+#include <mutex>
+#include <thread>
 #include <sys/time.h>
 
 #include <quda.h>
@@ -303,6 +308,8 @@ namespace quda {
 
   void flushChrono(int i = -1);
 
+  void flushSolverCache();
+
   void massRescale(cvector_ref<ColorSpinorField> &b, QudaInvertParam &param, bool for_multishift);
 
   void distanceReweight(cvector_ref<ColorSpinorField> &b, QudaInvertParam &param, bool inverse);
@@ -536,6 +543,88 @@ void initQuda(int dev)
 // possible flag to indicate we need to recompute the clover field
 static bool invalidate_clover = true;
 
+/**
+   @brief Whether loadGaugeQuda will skip the upload of a host gauge
+   field whose content is unchanged since the previous load of the
+   same link type, reusing the resident precise, sloppy,
+   preconditioner and extended fields (opt in with
+   QUDA_ENABLE_GAUGE_CACHE=1).  This assumes the resident fields are
+   not modified in place between loads.
+ */
+static bool gauge_cache_by_content()
+{
+  static bool init = false;
+  static bool enable = false;
+
+  if (!init) {
+    char *enable_str = getenv("QUDA_ENABLE_GAUGE_CACHE");
+    if (enable_str && strcmp(enable_str, "1") == 0) {
+      logQuda(QUDA_SUMMARIZE, "Enabling content-based caching of loaded gauge fields\n");
+      enable = true;
+    }
+    init = true;
+  }
+
+  return enable;
+}
+
+/**
+   The most recent host gauge field loaded for a given link type: its
+   checksum, the parameters used to create the resident fields from
+   it, and the generation of the resident fields that were created.
+ */
+struct GaugeLoadRecord {
+  uint64_t checksum = 0;
+  QudaGaugeParam param = {};
+  uint64_t generation = 0;
+};
+
+static std::map<QudaLinkType, GaugeLoadRecord> gauge_load_record;
+
+/**
+   Generation of the resident fields of each link type.  Generations
+   are unique across link types and never reused, so a record made
+   from one set of resident fields cannot match another set that
+   happens to be allocated at the same address.
+ */
+static std::map<QudaLinkType, uint64_t> gauge_generation;
+
+/**
+   @brief Mark the resident fields of the given link type as replaced
+   or modified in place.  This must be called by every routine that
+   writes to them outside of loadGaugeQuda.
+ */
+static void gaugeModified(QudaLinkType type)
+{
+  static uint64_t count = 0;
+  gauge_generation[type] = ++count;
+}
+
+/**
+   @brief Whether two loadGaugeQuda parameter sets would produce the
+   same resident gauge fields from the same host field.
+ */
+static bool gauge_load_match(const QudaGaugeParam &a, const QudaGaugeParam &b)
+{
+  for (int d = 0; d < 4; d++)
+    if (a.X[d] != b.X[d]) return false;
+  return a.anisotropy == b.anisotropy && a.tadpole_coeff == b.tadpole_coeff && a.scale == b.scale
+    && a.gauge_order == b.gauge_order && a.t_boundary == b.t_boundary && a.cpu_prec == b.cpu_prec
+    && a.cuda_prec == b.cuda_prec && a.reconstruct == b.reconstruct && a.cuda_prec_sloppy == b.cuda_prec_sloppy
+    && a.reconstruct_sloppy == b.reconstruct_sloppy && a.cuda_prec_refinement_sloppy == b.cuda_prec_refinement_sloppy
+    && a.reconstruct_refinement_sloppy == b.reconstruct_refinement_sloppy
+    && a.cuda_prec_precondition == b.cuda_prec_precondition && a.reconstruct_precondition == b.reconstruct_precondition
+    && a.cuda_prec_eigensolver == b.cuda_prec_eigensolver && a.reconstruct_eigensolver == b.reconstruct_eigensolver
+    && a.gauge_fix == b.gauge_fix && a.ga_pad == b.ga_pad && a.staggered_phase_type == b.staggered_phase_type
+    && a.staggered_phase_applied == b.staggered_phase_applied && a.i_mu == b.i_mu && a.overlap == b.overlap;
+}
+
+/**
+   @brief Return the resident precise field for a given link type
+   that loadGaugeQuda would create
+ */
+static const GaugeField *resident_precise_gauge(QudaLinkType type);
+
 // These utility functions are defined by the other "free" functions, but they
 // are declared here so they can be used in the initial cleanup phase of loadGaugeQuda
 
@@ -593,8 +682,26 @@ void loadGaugeQuda(void *h_gauge, QudaGaugeParam *param)
     }
     checksum = in_checksum;
     invalidate_clover = true;
+  } else if (gauge_cache_by_content() && !param->use_resident_gauge
+             && (param->type == QUDA_WILSON_LINKS || param->type == QUDA_ASQTAD_FAT_LINKS
+                 || param->type == QUDA_ASQTAD_LONG_LINKS)) {
+    auto &record = gauge_load_record[param->type];
+    uint64_t in_checksum = in->checksum();
+    if (resident_precise_gauge(param->type) && record.generation != 0
+        && record.generation == gauge_generation[param->type] && in_checksum == record.checksum
+        && gauge_load_match(*param, record.param)) {
+      logQuda(QUDA_VERBOSE, "Gauge field unchanged - using cached gauge field %lu\n", in_checksum);
+      delete in;
+      return;
+    }
+    record.checksum = in_checksum;
+    record.param = *param;
+    record.generation = 0; // set once the new resident field has been created
   }
 
+  // cached operators reference the fields about to be replaced
+  flushSolverCache();
+
   // free any current gauge field before new allocations to reduce memory overhead
   switch (param->type) {
     case QUDA_WILSON_LINKS:
@@ -752,6 +859,10 @@ void loadGaugeQuda(void *h_gauge, QudaGaugeParam *param)
       errorQuda("Invalid gauge type %d", param->type);
   }
 
+  gaugeModified(param->type);
+  if (gauge_cache_by_content() && gauge_load_record.count(param->type))
+    gauge_load_record[param->type].generation = gauge_generation[param->type];
+
   delete in;
 
   if (extendedGaugeResident) {
@@ -983,6 +1094,7 @@ void loadSloppyCloverQuda(const QudaPrecision *prec)
 void freeSloppyGaugeQuda()
 {
   if (!initialized) errorQuda("QUDA not initialized");
+  flushSolverCache();
 
   // Wilson gauges
   freeUniqueSloppyGaugeUtility(gaugePrecise, gaugeSloppy, gaugePrecondition, gaugeRefinement, gaugeEigensolver);
@@ -1058,6 +1170,11 @@ void freeUniqueGaugeQuda(QudaLinkType link_type)
 {
   if (!initialized) errorQuda("QUDA not initialized");
 
+  // the resident fields are going away, so drop their content record and any operators built on them
+  gauge_load_record.erase(link_type);
+  gaugeModified(link_type);
+  flushSolverCache();
+
   // Narrowly free a single type of links
   switch (link_type) {
   case QUDA_WILSON_LINKS:
@@ -1084,6 +1201,16 @@ void freeUniqueGaugeQuda(QudaLinkType link_type)
   }
 }
 
+static const GaugeField *resident_precise_gauge(QudaLinkType type)
+{
+  switch (type) {
+  case QUDA_WILSON_LINKS: return gaugePrecise;
+  case QUDA_ASQTAD_FAT_LINKS: return gaugeFatPrecise;
+  case QUDA_ASQTAD_LONG_LINKS: return gaugeLongPrecise;
+  default: return nullptr;
+  }
+}
+
 void freeGaugeSmearedQuda()
 {
   // thin wrapper
@@ -1098,6 +1225,8 @@ void freeGaugeTwoLinkQuda()
 
 void loadSloppyGaugeQuda(const QudaPrecision *prec, const QudaReconstructType *recon)
 {
+  flushSolverCache();
+
   // first do SU3 links (if they exist)
   if (gaugePrecise) {
     GaugeFieldParam gauge_param(*gaugePrecise);
@@ -1304,6 +1433,7 @@ void loadSloppyGaugeQuda(const QudaPrecision *prec, const QudaReconstructType *r
 void freeSloppyCloverQuda()
 {
   if (!initialized) errorQuda("QUDA not initialized");
+  flushSolverCache();
 
   // Delete cloverRefinement if it does not alias gaugeSloppy.
   if (cloverRefinement != cloverSloppy && cloverRefinement) delete cloverRefinement;
@@ -1353,6 +1483,8 @@ void endQuda(void)
 
     LatticeField::freeGhostBuffer();
     ColorSpinorField::freeGhostBuffer();
+    GaugeField::freeExtendedGhostBuffer();
+    if (getVerbosity() >= QUDA_SUMMARIZE) FieldTmp<ColorSpinorField>::print_stats();
     FieldTmp<ColorSpinorField>::destroy();
 
     blas_lapack::generic::destroy();
@@ -1361,6 +1493,7 @@ void endQuda(void)
 
     pool::flush_pinned();
     pool::flush_device();
+    pool::flush_host();
 
     host_free(num_failures_h);
     num_failures_h = nullptr;
@@ -1370,6 +1503,7 @@ void endQuda(void)
 
     saveTuneCache();
     saveProfile();
+    saveTrace();
 
     // flush any outstanding force monitoring (if enabled)
     flushForceMonitor();
@@ -2671,6 +2805,14 @@ void eigensolveQuda(void **host_evecs, double _Complex *host_evals, QudaEigParam
   } else {
     auto *eig_solve = quda::EigenSolver::create(eig_param, *m);
     (*eig_solve)(kSpace, evals);
+    if (eig_solve->compressed()) {
+      // expand the compressed eigenvectors one at a time for return to the host
+      for (auto &k : kSpace) {
+        ColorSpinorField v(cudaParam);
+        eig_solve->decompress(v, k);
+        k = std::move(v);
+      }
+    }
     delete eig_solve;
   }
 
@@ -2783,6 +2925,7 @@ void *newMultigridQuda(QudaMultigridParam *mg_param)
 }
 
 void destroyMultigridQuda(void *mg) {
+  flushSolverCache();
   delete static_cast<multigrid_solver*>(mg);
 }
 
@@ -2797,6 +2940,9 @@ void updateMultigridQuda(void *mg_, QudaMultigridParam *mg_param)
   auto *mg = static_cast<multigrid_solver*>(mg_);
   checkMultigridParam(mg_param);
 
+  // cached solvers wrap the hierarchy being updated
+  flushSolverCache();
+
   QudaInvertParam *param = mg_param->invert_param;
   // check the gauge fields have been created and set the precision as needed
   checkGauge(param);
@@ -2981,6 +3127,7 @@ void* newDeflationQuda(QudaEigParam *eig_param) {
 }
 
 void destroyDeflationQuda(void *df) {
+  flushSolverCache();
   delete static_cast<deflated_solver*>(df);
 }
 
@@ -3272,6 +3419,8 @@ void callMultiSrcQuda(void **_hp_x, void **_hp_b, QudaInvertParam *param, // col
       setupGaugeFields(collected_milc_longlink_field, gaugeLongPrecise, gaugeLongSloppy, gaugeLongPrecondition,
                        gaugeLongRefinement, gaugeLongEigensolver, gaugeLongExtended, long_links_bkup, profile.profile);
     }
+    gaugeModified(is_asqtad ? QUDA_ASQTAD_FAT_LINKS : QUDA_WILSON_LINKS);
+    if (is_asqtad) gaugeModified(QUDA_ASQTAD_LONG_LINKS);
     logQuda(QUDA_DEBUG_VERBOSE, "Split grid loaded gauge field...\n");
 
     // Load 'collected clover field'
@@ -3282,6 +3431,9 @@ void callMultiSrcQuda(void **_hp_x, void **_hp_b, QudaInvertParam *param, // col
       logQuda(QUDA_DEBUG_VERBOSE, "Split grid loaded clover field...\n");
     }
 
+    // cached operators are bound to the parent communicator and the fields just replaced
+    flushSolverCache();
+
     // Make a copy of the params we can mess with
     auto param_copy = *param;
 
@@ -3367,6 +3519,9 @@ void callMultiSrcQuda(void **_hp_x, void **_hp_b, QudaInvertParam *param, // col
       cloverRefinement = clov_bkup.refinement;
       cloverEigensolver = clov_bkup.eigensolver;
     }
+
+    // drop any operators built on the split-grid fields and communicator
+    flushSolverCache();
   }
 
   profilerStop(__func__);
@@ -4763,6 +4918,7 @@ void projectSU3Quda(void *gauge_h, double tol, QudaGaugeParam *param)
   if (!cudaGauge.StaggeredPhaseApplied() && param->staggered_phase_applied) cudaGauge.applyStaggeredPhase();
 
   if (*num_failures_h > 0) errorQuda("Error in the SU(3) unitarization: %d failures\n", *num_failures_h);
+  if (param->use_resident_gauge) gaugeModified(QUDA_WILSON_LINKS);
 
   if (param->return_result_gauge) cpuGauge.copy(cudaGauge);
 
@@ -4800,6 +4956,7 @@ void staggeredPhaseQuda(void *gauge_h, QudaGaugeParam *param)
     cudaGauge.applyStaggeredPhase();
   else
     cudaGauge.removeStaggeredPhase();
+  if (param->use_resident_gauge) gaugeModified(QUDA_WILSON_LINKS);
 
   if (param->return_result_gauge) cpuGauge.copy(cudaGauge);
 
@@ -4848,6 +5005,7 @@ void gaussGaugeQuda(unsigned long long seed, double sigma)
 
   if (!gaugePrecise) errorQuda("Cannot generate Gauss GaugeField as there is no resident gauge field");
   quda::gaugeGauss(*gaugePrecise, seed, sigma);
+  gaugeModified(QUDA_WILSON_LINKS);
 
   if (extendedGaugeResident) {
     extendedGaugeResident->copy(*gaugePrecise);
@@ -5625,6 +5783,192 @@ static void check_param(double _Complex *host_sinks, void **host_quark, int n_qu
     if (X[i] < 1 || X[i] > 512) errorQuda("Invalid lattice dimension %d", i);
 }
 
+/**
+   @brief Return the number of eigenvectors that laphSinkProject keeps
+   resident on the device.  This is set by the memory budget
+   QUDA_LAPH_EVEC_CACHE_MB (default 0), rounded down to a whole
+   number of tiles, with at least one tile always resident.
+   @param[in] evec_bytes Size of each device eigenvector
+   @param[in] n_evec Total number of eigenvectors
+   @param[in] tile_evec Eigenvector tile size
+ */
+static int laph_resident_evecs(size_t evec_bytes, int n_evec, int tile_evec)
+{
+  static bool init = false;
+  static size_t budget = 0;
+
+  if (!init) {
+    char *budget_str = getenv("QUDA_LAPH_EVEC_CACHE_MB");
+    if (budget_str) {
+      long mb = atol(budget_str);
+      if (mb < 0) errorQuda("QUDA_LAPH_EVEC_CACHE_MB=%ld cannot be negative", mb);
+      budget = static_cast<size_t>(mb) << 20;
+      logQuda(QUDA_SUMMARIZE, "QUDA_LAPH_EVEC_CACHE_MB set to %ld\n", mb);
+    }
+    init = true;
+  }
+
+  size_t n_tile = std::max(static_cast<size_t>(1), budget / (evec_bytes * tile_evec));
+  return static_cast<int>(std::min(static_cast<size_t>(n_evec), n_tile * tile_evec));
+}
+
+/**
+   @brief A helper thread, kept for the duration of laphSinkProject,
+   that runs one host task at a time
+ */
+class LaphPacker
+{
+  std::mutex mutex;
+  std::condition_variable cv;
+  std::function<void()> task;
+  bool busy = false;
+  bool done = false;
+  std::thread thread; // started last, once the state above exists
+
+  void run()
+  {
+    while (true) {
+      std::function<void()> f;
+      {
+        std::unique_lock<std::mutex> lock(mutex);
+        cv.wait(lock, [&] { return busy || done; });
+        if (!busy) return;
+        f = std::move(task);
+      }
+      f();
+      {
+        std::lock_guard<std::mutex> lock(mutex);
+        busy = false;
+      }
+      cv.notify_all();
+    }
+  }
+
+public:
+  LaphPacker() : thread([this] { run(); }) { }
+
+  ~LaphPacker()
+  {
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      done = true;
+    }
+    cv.notify_all();
+    thread.join();
+  }
+
+  /** Run f on the helper thread, once the previous task has completed */
+  void submit(std::function<void()> f)
+  {
+    std::unique_lock<std::mutex> lock(mutex);
+    cv.wait(lock, [&] { return !busy; });
+    task = std::move(f);
+    busy = true;
+    lock.unlock();
+    cv.notify_all();
+  }
+
+  /** Wait for the submitted task to complete */
+  void wait()
+  {
+    std::unique_lock<std::mutex> lock(mutex);
+    cv.wait(lock, [&] { return !busy; });
+  }
+};
+
+/**
+   @brief Double-buffered upload of a sequence of sets of host fields
+   for laphSinkProject.  Each set is packed from the application's
+   arrays into pinned memory by the packer thread, copied into a raw
+   device buffer on a copy stream, and reordered into device fields on
+   the default stream once its copy event has completed.  Using a set
+   starts the copy of the next set and the packing of the one after,
+   so both overlap with the work done on the set in use.
+ */
+class LaphUpload
+{
+  const std::vector<ColorSpinorField> &src; /** Host fields */
+  std::vector<std::pair<int, int>> sequence; /** First field and field count of each set, in order of use */
+  LaphPacker &packer;
+  const qudaStream_t copy_stream;
+  size_t bytes; /** Bytes per host field */
+  void *pinned[2] = {};
+  void *raw[2] = {};
+  qudaEvent_t copied[2];   /** Recorded on copy_stream once raw[b] is filled */
+  qudaEvent_t consumed[2]; /** Recorded on the default stream once raw[b] is reordered */
+  size_t next_pack = 0;
+  size_t next_copy = 0;
+  size_t next_use = 0;
+
+  void pack()
+  {
+    if (next_pack == sequence.size()) return;
+    auto b = next_pack % 2;
+    if (next_pack >= 2) qudaEventSynchronize(copied[b]); // the pinned buffer is free once its last copy completes
+    auto [first, count] = sequence[next_pack++];
+    packer.submit([this, b, first = first, count = count] {
+      for (auto k = 0; k < count; k++)
+        memcpy(static_cast<char *>(pinned[b]) + k * bytes, src[first + k].data(), bytes);
+    });
+  }
+
+  void copy()
+  {
+    if (next_copy == sequence.size()) return;
+    auto b = next_copy % 2;
+    packer.wait();
+    if (next_copy >= 2) qudaStreamWaitEvent(copy_stream, consumed[b], 0); // raw[b] is free once reordered
+    qudaMemcpyAsync(raw[b], pinned[b], sequence[next_copy].second * bytes, qudaMemcpyHostToDevice, copy_stream);
+    qudaEventRecord(copied[b], copy_stream);
+    next_copy++;
+  }
+
+public:
+  LaphUpload(const std::vector<ColorSpinorField> &src, const std::vector<std::pair<int, int>> &sequence,
+             LaphPacker &packer) :
+    src(src), sequence(sequence), packer(packer), copy_stream(device::get_stream(0)), bytes(src[0].Bytes())
+  {
+    size_t max_count = 0;
+    for (auto &set : sequence) max_count = std::max(max_count, static_cast<size_t>(set.second));
+    for (auto b = 0u; b < std::min(static_cast<size_t>(2), sequence.size()); b++) {
+      pinned[b] = pool_pinned_malloc(max_count * bytes);
+      raw[b] = pool_device_malloc(max_count * bytes);
+    }
+    for (auto b = 0; b < 2; b++) {
+      copied[b] = qudaEventCreate();
+      consumed[b] = qudaEventCreate();
+    }
+    pack();
+    copy();
+    pack();
+  }
+
+  ~LaphUpload()
+  {
+    packer.wait();
+    for (auto b = 0; b < 2; b++) {
+      if (pinned[b]) pool_pinned_free(pinned[b]);
+      if (raw[b]) pool_device_free(raw[b]);
+      qudaEventDestroy(copied[b]);
+      qudaEventDestroy(consumed[b]);
+    }
+  }
+
+  /** Reorder the next set into dst, then start on the following sets */
+  void use(std::vector<ColorSpinorField> &dst)
+  {
+    auto b = next_use % 2;
+    auto [first, count] = sequence[next_use++];
+    qudaStreamWaitEvent(device::get_default_stream(), copied[b], 0);
+    for (auto k = 0; k < count; k++)
+      copyGenericColorSpinor(dst[k], src[first + k], QUDA_CUDA_FIELD_LOCATION, nullptr,
+                             static_cast<char *>(raw[b]) + k * bytes);
+    qudaEventRecord(consumed[b], device::get_default_stream());
+    copy();
+    pack();
+  }
+};
+
 void laphSinkProject(double _Complex *host_sinks, void **host_quark, int n_quark, int tile_quark, void **host_evec,
                      int n_evec, int tile_evec, QudaInvertParam *inv_param, const int X[4])
 {
@@ -5657,39 +6001,71 @@ void laphSinkProject(double _Complex *host_sinks, void **host_quark, int n_quark
     evec[i] = ColorSpinorField(cpu_evec_param);
   }
 
-  // Create device vectors
+  // Create device vectors, zeroing the padding once since the tiles are reordered into them in place
   ColorSpinorParam quda_quark_param(cpu_quark_param, *inv_param, QUDA_CUDA_FIELD_LOCATION);
   quda_quark_param.gammaBasis = QUDA_DEGRAND_ROSSI_GAMMA_BASIS;
+  quda_quark_param.create = QUDA_ZERO_FIELD_CREATE;
   std::vector<ColorSpinorField> quda_quark(tile_quark, quda_quark_param);
 
-  // Create device vectors for evecs
+  // Create device vectors for evecs: keep as many evec tiles resident as the budget allows
   ColorSpinorParam quda_evec_param(cpu_evec_param, *inv_param, QUDA_CUDA_FIELD_LOCATION);
   std::vector<ColorSpinorField> quda_evec(tile_evec, quda_evec_param);
+  const int n_resident = laph_resident_evecs(quda_evec[0].Bytes(), n_evec, tile_evec);
+  resize(quda_evec, n_resident, quda_evec_param);
 
+  // The results are scattered directly into host_sinks, with each rank
+  // filling in its own time slices before the global sum
   auto Lt = x[3] * comm_dim(3);
-  std::vector<Complex> hostSink(n_quark * n_evec * Lt * 4);
-
-  for (auto i = 0; i < n_quark; i += tile_quark) {                       // iterate over all quarks
-    auto tile_i = std::min(tile_quark, n_quark - i);                     // handle remainder here
-    for (auto tq = 0; tq < tile_i; tq++) quda_quark[tq] = quark[i + tq]; // download quarks
-
-    for (auto j = 0; j < n_evec; j += tile_evec) {                       // iterate over all EV
-      auto tile_j = std::min(tile_evec, n_evec - j);                     // handle remainder here
-      for (auto te = 0; te < tile_j; te++) quda_evec[te] = evec[j + te]; // download evecs
+  const size_t n_sink = static_cast<size_t>(n_quark) * n_evec * Lt * 4;
+  auto sinks = reinterpret_cast<std::complex<double> *>(host_sinks);
+  std::fill(sinks, sinks + n_sink, 0.0);
+
+  // Iterate over the resident evec blocks, streaming all quark tiles through each block
+  const int n_quark_tile = (n_quark + tile_quark - 1) / tile_quark;
+  const int n_block = (n_evec + n_resident - 1) / n_resident;
+  const int n_work = n_block * n_quark_tile;
+
+  // The order in which the evec blocks and quark tiles are uploaded, a quark tile being reused while it stays resident
+  std::vector<std::pair<int, int>> evec_sets, quark_sets;
+  for (auto w = 0, resident_i = -1; w < n_work; w++) {
+    auto j0 = (w / n_quark_tile) * n_resident;
+    auto i = (w % n_quark_tile) * tile_quark;
+    if (w % n_quark_tile == 0) evec_sets.push_back({j0, std::min(n_resident, n_evec - j0)});
+    if (i != resident_i) quark_sets.push_back({i, std::min(tile_quark, n_quark - i)});
+    resident_i = i;
+  }
+
+  // Upload the next quark tile and evec block while the present ones are projected
+  LaphPacker packer;
+  LaphUpload evec_upload(evec, evec_sets, packer);
+  LaphUpload quark_upload(quark, quark_sets, packer);
+
+  for (auto w = 0, resident_i = -1; w < n_work; w++) {
+    auto j0 = (w / n_quark_tile) * n_resident;
+    auto i = (w % n_quark_tile) * tile_quark;
+    auto block_j = std::min(n_resident, n_evec - j0);
+    auto tile_i = std::min(tile_quark, n_quark - i);
+
+    if (w % n_quark_tile == 0) evec_upload.use(quda_evec);
+    if (i != resident_i) quark_upload.use(quda_quark);
+    resident_i = i;
+
+    for (auto j = j0; j < j0 + block_j; j += tile_evec) { // iterate over the resident EV
+      auto tile_j = std::min(tile_evec, j0 + block_j - j);  // handle remainder here
 
       std::vector<Complex> tmp(tile_i * tile_j * x[3] * 4);
 
       // We now perform the projection onto the eigenspace. The data
       // is placed in host_sinks in  T, spin order
       evecProjectLaplace3D(tmp, {quda_quark.begin(), quda_quark.begin() + tile_i},
-                           {quda_evec.begin(), quda_evec.begin() + tile_j});
+                           {quda_evec.begin() + (j - j0), quda_evec.begin() + (j - j0) + tile_j});
 
       for (auto tq = 0; tq < tile_i; tq++) {
         for (auto te = 0; te < tile_j; te++) {
           for (auto t = 0; t < x[3]; t++) {
             auto t_global = X[3] * comm_coord(3) + t;
             for (auto s = 0; s < 4; s++) {
-              hostSink[(((i + tq) * n_evec + (j + te)) * Lt + t_global) * 4 + s]
+              sinks[((static_cast<size_t>(i + tq) * n_evec + (j + te)) * Lt + t_global) * 4 + s]
                 = tmp[((tq * tile_j + te) * x[3] + t) * 4 + s];
             }
           }
@@ -5698,9 +6074,5 @@ void laphSinkProject(double _Complex *host_sinks, void **host_quark, int n_quark
     }
   }
 
-  comm_allreduce_sum(hostSink);
-
-  for (auto i = 0; i < n_quark * n_evec * Lt * 4; i++) { // iterate over all quarks
-    reinterpret_cast<std::complex<double> *>(host_sinks)[i] = hostSink[i];
-  }
+  comm_allreduce_sum_array(reinterpret_cast<double *>(host_sinks), 2 * n_sink);
 }
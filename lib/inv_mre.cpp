@@ -13,47 +13,50 @@ namespace quda
   /* Solve the equation A p_k psi_k = b by minimizing the residual and
      using Eigen's SVD algorithm for numerical stability */
   void MinResExt::solve(std::vector<Complex> &psi_, std::vector<ColorSpinorField> &p, std::vector<ColorSpinorField> &q,
-                        const ColorSpinorField &b, bool hermitian)
+                        cvector_ref<const ColorSpinorField> &b, bool hermitian)
   {
     typedef Matrix<Complex, Dynamic, Dynamic> matrix;
-    typedef Matrix<Complex, Dynamic, 1> vector;
 
     const int N = q.size();
-    vector phi(N), psi(N);
+    const int n_rhs = b.size();
+    matrix phi(N, n_rhs), psi(N, n_rhs);
     matrix A(N, N);
 
-    // form the a Nx(N+1) matrix using only a single reduction - this
+    // form the a Nx(N+n_rhs) matrix using only a single reduction - this
     // presently requires forgoing the matrix symmetry, but the improvement is well worth it
 
-    std::vector<Complex> A_(N * (N + 1));
+    std::vector<Complex> A_(N * (N + n_rhs));
 
     if (hermitian) {
       // linear system is Hermitian, solve directly
-      // compute rhs vector phi = P* b = (q_i, b) and construct the matrix
+      // compute rhs vectors phi = P* b = (q_i, b) and construct the matrix
       // P* Q = P* A P = (p_i, q_j) = (p_i, A p_j)
       blas::block::cDotProduct(A_, p, {q, b});
     } else {
       // linear system is not Hermitian, solve the normal system
-      // compute rhs vector phi = Q* b = (q_i, b) and construct the matrix
+      // compute rhs vectors phi = Q* b = (q_i, b) and construct the matrix
       // Q* Q = (A P)* (A P) = (q_i, q_j) = (A p_i, A p_j)
       blas::block::cDotProduct(A_, q, {q, b});
     }
 
     for (int i = 0; i < N; i++) {
-      phi(i) = A_[i * (N + 1) + N];
-      for (int j = 0; j < N; j++) { A(i, j) = A_[i * (N + 1) + j]; }
+      for (int k = 0; k < n_rhs; k++) phi(i, k) = A_[i * (N + n_rhs) + N + k];
+      for (int j = 0; j < N; j++) { A(i, j) = A_[i * (N + n_rhs) + j]; }
     }
 
     getProfile().TPSTOP(QUDA_PROFILE_CHRONO);
     getProfile().TPSTART(QUDA_PROFILE_EIGEN);
 
+    // the matrix is shared by all right hand sides so is only factorized once
     LDLT<matrix> cholesky(A);
     psi = cholesky.solve(phi);
 
     getProfile().TPSTOP(QUDA_PROFILE_EIGEN);
     getProfile().TPSTART(QUDA_PROFILE_CHRONO);
 
-    for (int i = 0; i < N; i++) psi_[i] = psi(i);
+    // coefficients are stored in block caxpy order: psi_[i * n_rhs + k] multiplies p_i for rhs k
+    for (int i = 0; i < N; i++)
+      for (int k = 0; k < n_rhs; k++) psi_[i * n_rhs + k] = psi(i, k);
   }
 
   /*
@@ -66,16 +69,21 @@ namespace quda
     3. Form the vector B_i = x_i^dagger b
     4. solve A_ij a_j  = B_i
     5. x = a_i p_i
+
+    With multiple right hand sides steps 1, 2 and the factorization
+    of G are shared, and steps 3-5 are batched over the sources.
   */
-  void MinResExt::operator()(ColorSpinorField &x, const ColorSpinorField &b, std::vector<ColorSpinorField> &p,
-                             std::vector<ColorSpinorField> &q)
+  void MinResExt::operator()(cvector_ref<ColorSpinorField> &x, cvector_ref<const ColorSpinorField> &b,
+                             std::vector<ColorSpinorField> &p, std::vector<ColorSpinorField> &q)
   {
     getProfile().TPSTART(QUDA_PROFILE_CHRONO);
 
     const int N = p.size();
-    logQuda(QUDA_VERBOSE, "Constructing minimum residual extrapolation with basis size %d\n", N);
+    const int n_rhs = b.size();
+    if (x.size() != b.size()) errorQuda("Solution size %lu does not match source size %lu", x.size(), b.size());
+    logQuda(QUDA_VERBOSE, "Constructing minimum residual extrapolation with basis size %d for %d sources\n", N, n_rhs);
 
-    if (N <= 1) {
+    if (N == 0 || (N == 1 && n_rhs == 1)) {
       if (N == 0)
         blas::zero(x);
       else
@@ -109,13 +117,15 @@ namespace quda
     if (apply_mat) mat(q, p);
 
     // Solution coefficient vectors
-    std::vector<Complex> alpha(N);
+    std::vector<Complex> alpha(N * n_rhs);
 
-    if (b.Precision() != p[0].Precision()) { // need to make a sloppy copy of b
-      ColorSpinorParam param(b);
+    if (b[0].Precision() != p[0].Precision()) { // need to make a sloppy copy of b
+      ColorSpinorParam param(b[0]);
       param.setPrecision(p[0].Precision(), p[0].Precision(), true);
-      param.create = QUDA_COPY_FIELD_CREATE;
-      solve(alpha, p, q, ColorSpinorField(param), hermitian);
+      param.create = QUDA_NULL_FIELD_CREATE;
+      std::vector<ColorSpinorField> b_sloppy(n_rhs, param);
+      blas::copy(b_sloppy, b);
+      solve(alpha, p, q, b_sloppy, hermitian);
     } else {
       solve(alpha, p, q, b, hermitian);
     }
@@ -125,17 +135,21 @@ namespace quda
 
     if (getVerbosity() >= QUDA_SUMMARIZE) {
       // compute the residual only if we're going to print it
-      ColorSpinorField r(b);
+      std::vector<ColorSpinorField> r(n_rhs);
+      for (int k = 0; k < n_rhs; k++) r[k] = b[k];
       for (auto &a : alpha) a = -a;
       blas::block::caxpy(alpha, q, r);
-      printfQuda("MinResExt: N = %d, |res| / |src| = %e\n", N, sqrt(blas::norm2(r) / blas::norm2(b)));
+      auto r2 = blas::norm2(r);
+      auto b2 = blas::norm2(b);
+      for (int k = 0; k < n_rhs; k++)
+        printfQuda("MinResExt: N = %d, rhs = %d, |res| / |src| = %e\n", N, k, sqrt(r2[k] / b2[k]));
     }
 
     getProfile().TPSTOP(QUDA_PROFILE_CHRONO);
   }
 
-  void chronoExtrapolate(ColorSpinorField &x, const ColorSpinorField &b, std::vector<ColorSpinorField> &basis,
-                         DiracMatrix &m, bool hermitian)
+  void chronoExtrapolate(cvector_ref<ColorSpinorField> &x, cvector_ref<const ColorSpinorField> &b,
+                         std::vector<ColorSpinorField> &basis, DiracMatrix &m, bool hermitian)
   {
     getProfile().TPSTART(QUDA_PROFILE_CHRONO);
 
@@ -0,0 +1,277 @@
+#include <cmath>
+
+#include <quda_internal.h>
+#include <color_spinor_field.h>
+#include <blas_quda.h>
+#include <invert_quda.h>
+#include <util_quda.h>
+#include <reliable_updates.h>
+
+/**
+   @file inv_pipelined_cg.cpp
+
+   Pipelined conjugate gradient (Ghysels and Vanroose, Parallel
+   Computing 40, 224 (2014)).  The two inner products of each
+   iteration are fused into a single reduction that is issued as a
+   non-blocking allreduce, and the operator application w -> Aw for
+   the next iteration is computed while it is in flight.  This comes
+   at the cost of three additional vector recurrences, s = Ap, z = As
+   and w = Ar, which accumulate rounding error faster than standard
+   CG.  This is countered with residual replacement driven by the
+   usual reliable updates: when triggered, the residual is recomputed
+   in high precision and s, z and w are recomputed from p and r.
+ */
+
+namespace quda
+{
+
+  PipelinedCG::PipelinedCG(const DiracMatrix &mat, const DiracMatrix &matSloppy, const DiracMatrix &matPrecon,
+                           const DiracMatrix &matEig, SolverParam &param) :
+    Solver(mat, matSloppy, matPrecon, matEig, param)
+  {
+  }
+
+  void PipelinedCG::create(cvector_ref<ColorSpinorField> &x, cvector_ref<const ColorSpinorField> &b)
+  {
+    Solver::create(x, b);
+
+    if (!init || r.size() != b.size()) {
+      getProfile().TPSTART(QUDA_PROFILE_INIT);
+
+      resize(r, b.size(), QUDA_NULL_FIELD_CREATE, b[0]);
+      resize(y, b.size(), QUDA_NULL_FIELD_CREATE, b[0]);
+
+      // sloppy fields
+      ColorSpinorParam csParam(x[0]);
+      csParam.create = QUDA_NULL_FIELD_CREATE;
+      csParam.setPrecision(param.precision_sloppy);
+      resize(p, b.size(), csParam);
+      resize(s, b.size(), csParam);
+      resize(z, b.size(), csParam);
+      resize(w, b.size(), csParam);
+      resize(q, b.size(), csParam);
+
+      if (param.precision != param.precision_sloppy) {
+        resize(r_sloppy, b.size(), csParam);
+        resize(x_sloppy, b.size(), csParam);
+      } else {
+        create_alias(r_sloppy, r);
+      }
+
+      init = true;
+      getProfile().TPSTOP(QUDA_PROFILE_INIT);
+    }
+
+    if (param.precision == param.precision_sloppy) create_alias(x_sloppy, x);
+  }
+
+  cvector_ref<const ColorSpinorField> PipelinedCG::get_residual()
+  {
+    if (!init) errorQuda("No residual vector present");
+    return r;
+  }
+
+  void PipelinedCG::operator()(cvector_ref<ColorSpinorField> &x, cvector_ref<const ColorSpinorField> &b)
+  {
+    if (param.is_preconditioner) commGlobalReductionPush(param.global_reduction);
+
+    if (param.residual_type & QUDA_HEAVY_QUARK_RESIDUAL) errorQuda("Pipelined CG does not support heavy-quark residual");
+    if (param.deflate) errorQuda("Pipelined CG does not support deflation");
+    if (param.use_alternative_reliable)
+      logQuda(QUDA_SUMMARIZE, "Pipelined CG does not support alternative reliable updates, reverting to traditional\n");
+
+    if (param.maxiter == 0 || param.Nsteps == 0) {
+      if (param.use_init_guess == QUDA_USE_INIT_GUESS_NO) blas::zero(x);
+      if (param.is_preconditioner) commGlobalReductionPop();
+      return;
+    }
+
+    if (!param.is_preconditioner) getProfile().TPSTART(QUDA_PROFILE_INIT);
+
+    auto b2 = blas::norm2(b);
+
+    // Check to see that we're not trying to invert on a zero-field source
+    if (is_zero_src(x, b, b2)) {
+      if (!param.is_preconditioner) getProfile().TPSTOP(QUDA_PROFILE_INIT);
+      if (param.is_preconditioner) commGlobalReductionPop();
+      return;
+    }
+
+    create(x, b);
+
+    // compute initial residual
+    vector<double> r2(b.size());
+    if (param.use_init_guess == QUDA_USE_INIT_GUESS_YES) {
+      mat(r, x);
+      r2 = blas::xmyNorm(b, r);
+      for (auto i = 0u; i < b.size(); i++)
+        if (b2[i] == 0) b2[i] = r2[i];
+      blas::copy(y, x);
+    } else {
+      blas::copy(r, b);
+      r2 = b2;
+      blas::zero(y);
+    }
+
+    blas::zero(x_sloppy);
+    blas::copy(r_sloppy, r);
+    matSloppy(w, r_sloppy);
+
+    if (!param.is_preconditioner) {
+      getProfile().TPSTOP(QUDA_PROFILE_INIT);
+      getProfile().TPSTART(QUDA_PROFILE_PREAMBLE);
+    }
+
+    auto stop = stopping(param.tol, b2, param.residual_type); // stopping condition of solver
+
+    ReliableUpdatesParams ru_params;
+    ru_params.alternative_reliable = false;
+    ru_params.u = precisionEpsilon(param.precision_sloppy);
+    ru_params.uhigh = precisionEpsilon();
+    ru_params.Anorm = 0.0;
+    ru_params.delta = param.delta;
+    ru_params.maxResIncrease = param.max_res_increase;
+    ru_params.maxResIncreaseTotal = param.max_res_increase_total;
+    ru_params.use_heavy_quark_res = false;
+
+    ReliableUpdates ru(ru_params, r2[0]);
+
+    // the reduction is only global if it would be for the regular blas reductions
+    const bool global_reduction = commGlobalReduction();
+
+    vector<double> alpha(b.size(), 0.0), alpha_old(b.size(), 0.0), beta(b.size(), 0.0), malpha(b.size());
+    vector<double> gamma_old(b.size(), 0.0), r2_old(b.size(), 0.0);
+    std::vector<double> reduce_buffer(2 * b.size());
+
+    if (!param.is_preconditioner) {
+      getProfile().TPSTOP(QUDA_PROFILE_PREAMBLE);
+      getProfile().TPSTART(QUDA_PROFILE_COMPUTE);
+    }
+
+    int k = 0;
+    PrintStats("PipelinedCG", k, r2, b2);
+    bool converged = convergenceL2(r2, stop);
+    bool reported = true; // whether r2 of the current iterate has been reported
+
+    while (!converged && k < param.maxiter) {
+      // fused local reduction of gamma = (r, r) and delta = (w, r), issued as a non-blocking allreduce
+      commGlobalReductionPush(false);
+      auto rw = blas::cDotProductNormA(r_sloppy, w);
+      commGlobalReductionPop();
+      for (auto i = 0u; i < b.size(); i++) {
+        reduce_buffer[2 * i + 0] = rw[i].z;
+        reduce_buffer[2 * i + 1] = rw[i].x;
+      }
+      ReduceHandle *rh
+        = global_reduction ? comm_allreduce_sum_array_start(reduce_buffer.data(), reduce_buffer.size()) : nullptr;
+
+      // overlap the operator application for the next iteration with the reduction
+      matSloppy(q, w);
+
+      if (rh) comm_allreduce_wait(rh);
+      for (auto i = 0u; i < b.size(); i++) r2[i] = reduce_buffer[2 * i + 0];
+      if (!reported) PrintStats("PipelinedCG", k, r2, b2);
+      reported = true;
+
+      ru.update_rNorm(sqrt(r2[0]));
+      ru.evaluate(r2_old[0]);
+      // force a reliable update if we are within target tolerance (only if doing reliable updates)
+      if (convergenceL2(r2, stop) && param.delta >= param.tol) ru.set_updateX();
+
+      if (ru.trigger() && k > 0 && ru.steps_since_reliable > 0) {
+        // residual replacement: recompute r in high precision and
+        // re-derive the recurrence vectors from p and the new residual
+        blas::xpy(x_sloppy, y);
+        mat(r, y);
+        r2 = blas::xmyNorm(b, r);
+        blas::copy(r_sloppy, r);
+        blas::zero(x_sloppy);
+
+        ru.update_norm(r2[0], y[0]);
+        bool L2breakdown = false;
+        if (ru.reliable_break(r2[0], stop[0], L2breakdown, 0)) break;
+
+        matSloppy(w, r_sloppy);
+        matSloppy(s, p);
+        matSloppy(z, s);
+
+        ru.reset(r2[0]);
+
+        PrintStats("PipelinedCG", k, r2, b2);
+        converged = convergenceL2(r2, stop);
+        continue; // q and the reduction refer to the replaced residual, so redo them
+      }
+
+      // straight after a replacement the iterated r2 may undercut the true one, so don't trust it
+      converged = convergenceL2(r2, stop) && (param.delta < param.tol || ru.steps_since_reliable == 0);
+      if (converged) break;
+
+      for (auto i = 0u; i < b.size(); i++) {
+        double gamma = reduce_buffer[2 * i + 0];
+        double delta = reduce_buffer[2 * i + 1];
+        beta[i] = k == 0 ? 0.0 : gamma / gamma_old[i];
+        double denom = k == 0 ? delta : delta - beta[i] * gamma / alpha_old[i];
+        if (denom <= 0.0) { // loss of positivity in the recurrences: restart this system with a steepest descent step
+          beta[i] = 0.0;
+          denom = delta;
+        }
+        alpha[i] = gamma / denom;
+        malpha[i] = -alpha[i];
+        gamma_old[i] = gamma;
+      }
+
+      if (k == 0) {
+        blas::copy(z, q);
+        blas::copy(s, w);
+        blas::copy(p, r_sloppy);
+      } else {
+        blas::xpayz(q, beta, z, z);
+        blas::xpayz(w, beta, s, s);
+        blas::xpayz(r_sloppy, beta, p, p);
+      }
+
+      blas::axpy(alpha, p, x_sloppy);
+      blas::axpy(malpha, s, r_sloppy);
+      blas::axpy(malpha, z, w);
+
+      alpha_old = alpha;
+      r2_old = r2;
+      ru.accumulate_norm(alpha[0]);
+
+      k++;
+      reported = false;
+    }
+
+    blas::xpy(x_sloppy, y);
+    blas::copy(x, y);
+
+    if (!param.is_preconditioner) {
+      getProfile().TPSTOP(QUDA_PROFILE_COMPUTE);
+      getProfile().TPSTART(QUDA_PROFILE_EPILOGUE);
+
+      param.iter += k;
+
+      if (k == param.maxiter) warningQuda("Exceeded maximum iterations %d", param.maxiter);
+    }
+
+    logQuda(QUDA_VERBOSE, "PipelinedCG: Reliable updates = %d\n", ru.rUpdate);
+
+    if (param.compute_true_res) {
+      // compute the true residuals
+      mat(r, x);
+      auto true_r2 = blas::xmyNorm(b, r);
+      auto hq = blas::HeavyQuarkResidualNorm(x, r);
+      for (auto i = 0u; i < b.size(); i++) {
+        param.true_res[i] = sqrt(true_r2[i] / b2[i]);
+        param.true_res_hq[i] = sqrt(hq[i].z);
+      }
+    }
+
+    PrintSummary("PipelinedCG", k, r2, b2, stop);
+
+    if (!param.is_preconditioner) getProfile().TPSTOP(QUDA_PROFILE_EPILOGUE);
+
+    if (param.is_preconditioner) commGlobalReductionPop();
+  }
+
+} // namespace quda
@@ -7,6 +7,7 @@
 
 // for int max
 #include <limits>
+#include <vector>
 
 #include <stdlib.h>
 #include <stdio.h>
@@ -19,6 +20,11 @@
    QMP_logical_topology_is_declared()
    this_node
    QMP_abort()
+
+   The logical topology is only queried by quda_setup_layout, which
+   tabulates the node of each hypercube, so that the layout remains
+   valid if QIO is subsequently run on a communicator without a
+   declared topology (see qio_begin_private_comm).
 */
 
 static int *squaresize = nullptr; /* dimensions of hypercubes */
@@ -28,6 +34,8 @@ static size_t *size1[2] = {nullptr, nullptr}, *size2 = nullptr;
 static size_t sites_on_node;
 static int *mcoord = nullptr;
 static bool single_parity = false;
+static std::vector<int> square_node; /* node of each hypercube, lexicographic in the hypercube coordinates */
+static std::vector<int> node_square; /* hypercube coordinates of each node */
 
 int quda_setup_layout(int len[], int nd, int, int single_parity_)
 {
@@ -57,6 +65,21 @@ int quda_setup_layout(int len[], int nd, int, int single_parity_)
   sites_on_node = 1;
   for (int i = 0; i < ndim; ++i) { sites_on_node *= squaresize[i]; }
 
+  int number_of_nodes = 1;
+  for (int i = 0; i < ndim; i++) number_of_nodes *= nsquares[i];
+  square_node.resize(number_of_nodes);
+  node_square.resize(number_of_nodes * ndim);
+  for (int s = 0; s < number_of_nodes; s++) {
+    for (int i = 0, r = s; i < ndim; i++) {
+      mcoord[i] = r % nsquares[i];
+      r /= nsquares[i];
+    }
+    int node = QMP_get_node_number_from(mcoord);
+    if (node < 0 || node >= number_of_nodes) return 1;
+    square_node[s] = node;
+    for (int i = 0; i < ndim; i++) node_square[node * ndim + i] = mcoord[i];
+  }
+
   if (size1[0]) free(size1[0]);
   size1[0] = (size_t *)malloc(2 * (ndim + 1) * sizeof(size_t));
   size1[1] = size1[0] + ndim + 1;
@@ -78,8 +101,9 @@ int quda_setup_layout(int len[], int nd, int, int single_parity_)
 
 int quda_node_number(const int x[])
 {
-  for (int i = 0; i < ndim; i++) { mcoord[i] = x[i] / squaresize[i]; }
-  return QMP_get_node_number_from(mcoord);
+  int s = 0;
+  for (int i = ndim - 1; i >= 0; i--) { s = s * nsquares[i] + x[i] / squaresize[i]; }
+  return square_node[s];
 }
 
 #ifdef QIO_HAS_EXTENDED_LAYOUT
@@ -130,7 +154,7 @@ int quda_node_index(const int x[])
 void quda_get_coords_helper(int x[], int node, size_t index)
 {
   size_t si = index;
-  int *m = QMP_get_logical_coordinates_from(node);
+  const int *m = &node_square[node * ndim];
 
   size_t s = 0;
   for (int i = 0; i < ndim; ++i) {
@@ -165,8 +189,6 @@ void quda_get_coords_helper(int x[], int node, size_t index)
     x[0] += index;
   }
 
-  free(m);
-
   /* Check the result */
 #ifdef QIO_HAS_EXTENDED_LAYOUT
   size_t node_index = quda_node_index_ext(x, NULL);
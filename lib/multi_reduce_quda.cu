@@ -146,7 +146,33 @@ namespace quda {
           }
 
         } else {
-          errorQuda("Only implemented for GPU fields");
+          if (checkOrder(x[0], y[0], z[0], w[0]) != QUDA_SPACE_SPIN_COLOR_FIELD_ORDER)
+            errorQuda("CPU Blas functions expect AoS field order");
+
+          using host_store_t = typename host_type_mapper<store_t>::type;
+          using host_y_store_t = typename host_type_mapper<y_store_t>::type;
+          using host_real_t = typename mapper<host_y_store_t>::type;
+          Reducer<double, host_real_t> r_(NXZ, NYW);
+
+          // redefine site_unroll with host_store types to ensure we have correct N/Ny/M values
+          constexpr bool site_unroll = !std::is_same<host_store_t, host_y_store_t>::value || isFixed<host_store_t>::value;
+          constexpr int N = n_vector<host_store_t, false, nSpin, site_unroll>();
+          constexpr int Ny = n_vector<host_y_store_t, false, nSpin, site_unroll>();
+          constexpr int M = N; // if site unrolling then M=N will be 24/6, e.g., full AoS
+          const int length = x0.Length() / M;
+
+          using Arg = MultiReduceArg<host_real_t, M, NXZ, host_store_t, N, host_y_store_t, Ny, decltype(r_)>;
+          Arg arg(x, y, z, w, r_, NYW, length, nParity);
+
+          // each of the NYW reductions returns the NXZ partial sums for its y vector
+          std::vector<typename Arg::reduce_t> result_(arg.NYW);
+          launch<MultiReduce_, true>(result_, tp, stream, arg);
+
+          for (int i = 0; i < NXZ; i++) {
+            for (int j = 0; j < arg.NYW; j++) {
+              reinterpret_cast<host_reduce_t*>(result.data())[i * arg.NYW + j] = result_[j][i];
+            }
+          }
         }
       }
 
@@ -722,6 +722,8 @@ namespace quda
   {
     pushLevel(param.level);
 
+    vector_io.reset(); // complete any outstanding save of the null space vectors
+
     if (param.level < param.Nlevel - 1) {
       if (coarse) delete coarse;
       if (param.level == param.Nlevel-1 || param.cycle_type == QUDA_MG_CYCLE_RECURSIVE) {
@@ -1277,8 +1279,8 @@ namespace quda
       vec_outfile += std::to_string(param.level);
       vec_outfile += "_nvec_";
       vec_outfile += std::to_string(param.mg_global.n_vec[param.level]);
-      VectorIO io(vec_outfile, false, param.mg_global.mg_vec_partfile[param.level]);
-      io.save(B);
+      vector_io = std::make_unique<VectorIO>(vec_outfile, false, param.mg_global.mg_vec_partfile[param.level]);
+      vector_io->save_async(B);
       popLevel();
       getProfile().TPSTOP(QUDA_PROFILE_IO);
     }
@@ -1292,6 +1294,7 @@ namespace quda
       saveVectors(param.B);
     }
     if (param.level < param.Nlevel - 2) coarse->dumpNullVectors();
+    if (vector_io) vector_io->wait(); // the dump is complete on return
   }
 
   void MG::generateNullVectors(std::vector<ColorSpinorField> &B, bool refresh)
@@ -42,9 +42,9 @@ namespace quda {
     {
       TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity());
       if (heatbath) {
-        launch<HB>(tp, stream, MonteArg<Float, nColor, recon, true>(U, beta, rng.State(), mu, parity));
+        launch<HB>(tp, stream, MonteArg<Float, nColor, recon, true>(U, beta, rng.Accessor(), mu, parity));
       } else {
-        launch<HB>(tp, stream, MonteArg<Float, nColor, recon, false>(U, beta, rng.State(), mu, parity));
+        launch<HB>(tp, stream, MonteArg<Float, nColor, recon, false>(U, beta, rng.Accessor(), mu, parity));
       }
     }
 
@@ -87,12 +87,12 @@ namespace quda {
       //NEED TO CHECK THIS!!!!!!
       if ( nColor == 3 ) {
         long long byte = 20LL * recon * sizeof(Float);
-        if (heatbath) byte += 2LL * sizeof(RNGState);
+        if (heatbath && rng.Type() == RNGType::STATEFUL) byte += 2LL * sizeof(RNGState);
         byte *= U.LocalVolumeCB();
         return byte;
       } else {
         long long byte = 20LL * nColor * nColor * 2 * sizeof(Float);
-        if (heatbath) byte += 2LL * sizeof(RNGState);
+        if (heatbath && rng.Type() == RNGType::STATEFUL) byte += 2LL * sizeof(RNGState);
         byte *= U.LocalVolumeCB();
         return byte;
       }
@@ -6,6 +6,7 @@
 #include <layout_hyper.h>
 
 #include <string>
+#include <functional>
 
 using namespace quda;
 
@@ -13,6 +14,9 @@ static QIO_Layout layout;
 static int lattice_size[4];
 int quda_this_node;
 
+static QMP_comm_t private_comm = nullptr; /* duplicate of the default communicator used by QIO on a helper thread */
+static QMP_comm_t main_comm = nullptr;    /* default communicator while the private one is in use */
+
 std::ostream &operator<<(std::ostream &out, const QIO_Layout &layout)
 {
   out << "node_number = " << layout.node_number << std::endl;
@@ -126,8 +130,13 @@ QIO_Writer *open_test_output(const char *filename, int volfmt, int serpar, int i
   return outfile;
 }
 
-int read_field(QIO_Reader *infile, int count, void *field_in[], QudaPrecision cpu_prec, QudaSiteSubset, QudaParity,
-               int nSpin, int nColor, int len)
+/**
+   Read the next record from infile.  The record's field count is
+   passed to get_field, which returns the array of destination fields
+   (with at least that many entries) or nullptr to reject the record.
+*/
+template <typename GetField>
+int read_field_record(QIO_Reader *infile, GetField &&get_field, QudaPrecision cpu_prec, int nSpin, int nColor, int len)
 {
   // Get the QIO record and string
   char dummy[100] = "";
@@ -160,7 +169,9 @@ int read_field(QIO_Reader *infile, int count, void *field_in[], QudaPrecision cp
       warningQuda("QIO_get_colors %d does not match expected number of spins %d", in_nColor, nColor);
   }
 
-  if (in_count != count) errorQuda("QIO_get_datacount %d does not match expected number of fields %d", in_count, count);
+  int count = in_count;
+  void **field_in = get_field(in_count);
+  if (!field_in) errorQuda("QIO_get_datacount %d does not match expected number of fields", in_count);
 
   if (in_typesize != file_prec * len)
     errorQuda("QIO_get_typesize %d does not match expected datasize %d", in_typesize, file_prec * len);
@@ -197,6 +208,17 @@ int read_field(QIO_Reader *infile, int count, void *field_in[], QudaPrecision cp
   return 0;
 }
 
+int read_field(QIO_Reader *infile, int count, void *field_in[], QudaPrecision cpu_prec, QudaSiteSubset, QudaParity,
+               int nSpin, int nColor, int len)
+{
+  auto get_field = [&](int in_count) -> void ** {
+    if (in_count != count)
+      errorQuda("QIO_get_datacount %d does not match expected number of fields %d", in_count, count);
+    return field_in;
+  };
+  return read_field_record(infile, get_field, cpu_prec, nSpin, nColor, len);
+}
+
 int read_su3_field(QIO_Reader *infile, int count, void *field_in[], QudaPrecision cpu_prec)
 {
   return read_field(infile, count, field_in, cpu_prec, QUDA_FULL_SITE_SUBSET, QUDA_INVALID_PARITY, 1, 9, 18);
@@ -288,6 +310,63 @@ void read_spinor_field(const char *filename, void *V[], QudaPrecision precision,
   printfQuda("%s: Closed file for reading\n",__func__);
 }
 
+void qio_begin_private_comm(const int *X, QudaSiteSubset subset)
+{
+  if (main_comm) errorQuda("QIO is already using its private communicator");
+  quda_this_node = QMP_get_node_number();
+
+  // set the layout while the default communicator still carries the logical topology
+  set_layout(X, subset);
+
+  // the duplicate keeps the node numbering, so the layout remains valid
+  if (!private_comm && QMP_comm_split(QMP_comm_get_default(), 0, quda_this_node, &private_comm) != QMP_SUCCESS)
+    errorQuda("Unable to create the QIO communicator");
+  main_comm = QMP_comm_get_default();
+  QMP_comm_set_default(private_comm);
+}
+
+void qio_end_private_comm()
+{
+  if (!main_comm) errorQuda("QIO is not using its private communicator");
+  QMP_comm_set_default(main_comm);
+  main_comm = nullptr;
+}
+
+void *open_spinor_field_reader(const char *filename, const int *X, QudaSiteSubset subset)
+{
+  quda_this_node = QMP_get_node_number();
+
+  // the layout has already been set by qio_begin_private_comm
+  if (!main_comm) set_layout(X, subset);
+
+  /* Open the test file for reading */
+  QIO_Reader *infile = open_test_input(filename, QIO_UNKNOWN, QIO_PARALLEL);
+  if (infile == NULL) { errorQuda("Open file failed\n"); }
+  return infile;
+}
+
+int read_spinor_field_record(void *reader, QudaPrecision precision, int nColor, int nSpin, int Nmax,
+                             const std::function<void **(int n)> &get_chunk)
+{
+  int n = 0;
+  auto get_field = [&](int in_count) -> void ** {
+    if (in_count > Nmax) errorQuda("QIO_get_datacount %d exceeds remaining number of fields %d", in_count, Nmax);
+    n = in_count;
+    return get_chunk(n);
+  };
+  int status = read_field_record(static_cast<QIO_Reader *>(reader), get_field, precision, nSpin, nColor,
+                                 2 * nSpin * nColor);
+  if (status) { errorQuda("read_spinor_fields failed %d\n", status); }
+  return n;
+}
+
+void close_spinor_field_reader(void *reader)
+{
+  /* Close the file */
+  QIO_close_read(static_cast<QIO_Reader *>(reader));
+  printfQuda("%s: Closed file for reading\n", __func__);
+}
+
 int write_field(QIO_Writer *outfile, int count, const void *field_out[], QudaPrecision file_prec, QudaPrecision cpu_prec,
                 QudaSiteSubset subset, QudaParity parity, int nSpin, int nColor, int len, const char *type)
 {
@@ -440,3 +519,33 @@ void write_spinor_field(const char *filename, const void *V[], QudaPrecision pre
   QIO_close_write(outfile);
   printfQuda("%s: Closed file for writing\n",__func__);
 }
+
+void *open_spinor_field_writer(const char *filename, const int *X, QudaSiteSubset subset, bool partfile)
+{
+  quda_this_node = QMP_get_node_number();
+
+  // the layout has already been set by qio_begin_private_comm
+  if (!main_comm) set_layout(X, subset);
+
+  QIO_Writer *outfile = open_test_output(filename, (partfile ? QIO_PARTFILE : QIO_SINGLEFILE), QIO_PARALLEL, QIO_ILDGNO);
+  if (outfile == NULL) { errorQuda("Open file failed\n"); }
+  return outfile;
+}
+
+void write_spinor_field_record(void *writer, const void *V[], QudaPrecision precision, QudaSiteSubset subset,
+                               QudaParity parity, int nColor, int nSpin, int n)
+{
+  char type[128];
+  sprintf(type, "QUDA_%sNs%dNc%d_ColorSpinorField", (precision == QUDA_DOUBLE_PRECISION) ? "D" : "F", nSpin, nColor);
+
+  int status = write_field(static_cast<QIO_Writer *>(writer), n, V, precision, precision, subset, parity, nSpin, nColor,
+                           2 * nSpin * nColor, type);
+  if (status) { errorQuda("write_spinor_fields failed %d\n", status); }
+}
+
+void close_spinor_field_writer(void *writer)
+{
+  /* Close the file */
+  QIO_close_write(static_cast<QIO_Writer *>(writer));
+  printfQuda("%s: Closed file for writing\n", __func__);
+}
@@ -16,7 +16,7 @@ namespace quda
       switch (type) {
       case QUDA_MEMORY_DEVICE: device = pool ? pool_device_malloc(size) : device_malloc(size); break;
       case QUDA_MEMORY_DEVICE_PINNED: device = device_pinned_malloc(size); break;
-      case QUDA_MEMORY_HOST: host = safe_malloc(size); break;
+      case QUDA_MEMORY_HOST: host = pool ? pool_host_malloc(size) : safe_malloc(size); break;
       case QUDA_MEMORY_HOST_PINNED: host = pool ? pool_pinned_malloc(size) : pinned_malloc(size); break;
       case QUDA_MEMORY_MAPPED:
         host = mapped_malloc(size);
@@ -75,7 +75,7 @@ namespace quda
       switch (type) {
       case QUDA_MEMORY_DEVICE: pool ? pool_device_free(device) : device_free(device); break;
       case QUDA_MEMORY_DEVICE_PINNED: device_pinned_free(device); break;
-      case QUDA_MEMORY_HOST: host_free(host); break;
+      case QUDA_MEMORY_HOST: pool ? pool_host_free(host) : host_free(host); break;
       case QUDA_MEMORY_HOST_PINNED: pool ? pool_pinned_free(host) : host_free(host); break;
       case QUDA_MEMORY_MAPPED: host_free(host); break;
       default: errorQuda("Unknown memory type %d", type);
@@ -10,16 +10,11 @@ namespace quda {
 
     RNG &rng;
     const LatticeField &meta;
-    unsigned long long seed;
     unsigned int minThreads() const { return meta.VolumeCB(); }
     bool tuneSharedBytes() const { return false; }
 
   public:
-    RNGInit(RNG &rng, const LatticeField &meta, unsigned long long seed) :
-      TunableKernel2D(meta, meta.SiteSubset()),
-      rng(rng),
-      meta(meta),
-      seed(seed)
+    RNGInit(RNG &rng, const LatticeField &meta) : TunableKernel2D(meta, meta.SiteSubset()), rng(rng), meta(meta)
     {
       apply(device::get_default_stream());
     }
@@ -27,18 +22,61 @@ namespace quda {
     void apply(const qudaStream_t &stream)
     {
       TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity());
-      launch_device<init_random>(tp, stream, rngArg(rng.State(), seed, meta));
+      launch_device<init_random>(tp, stream, rngArg(rng.Accessor(), meta));
     }
 
     long long flops() const { return 0; }
     long long bytes() const { return 0; }
   };
 
-  RNG::RNG(const LatticeField &meta, unsigned long long seedin) :
-    size(meta.LocalVolume()),
-    state((RNGState *)device_malloc(size * sizeof(RNGState)), [](RNGState *ptr){ device_free(ptr); } ),
+  /**
+     @brief Resolve RNGType::DEFAULT from the environment variable
+     QUDA_RNG_TYPE ("stateful" or "counter")
+  */
+  static RNGType get_default_rng_type()
+  {
+    static bool init = false;
+    static RNGType type = RNGType::STATEFUL;
+
+    if (!init) {
+      char *type_str = getenv("QUDA_RNG_TYPE");
+      if (type_str) {
+        if (strcmp(type_str, "stateful") == 0) {
+          type = RNGType::STATEFUL;
+        } else if (strcmp(type_str, "counter") == 0) {
+          type = RNGType::COUNTER;
+        } else {
+          errorQuda("QUDA_RNG_TYPE=%s not recognized, expected \"stateful\" or \"counter\"", type_str);
+        }
+        logQuda(QUDA_SUMMARIZE, "QUDA_RNG_TYPE set to %s\n", type_str);
+      }
+      init = true;
+    }
+
+    return type;
+  }
+
+  RNG::RNG(const LatticeField &meta, unsigned long long seedin, RNGType type) :
+    type(type == RNGType::DEFAULT ? get_default_rng_type() : type),
+    size(this->type == RNGType::STATEFUL ? meta.LocalVolume() : 0),
     seed(seedin)
   {
+    accessor.seed = seed;
+    for (int i = 0; i < 4; i++) {
+      accessor.commCoord[i] = comm_coord(i);
+      accessor.X[i] = meta.LocalX()[i];
+      accessor.X_global[i] = accessor.X[i] * comm_dim(i);
+    }
+
+    if (this->type == RNGType::COUNTER) {
+      if (getVerbosity() >= QUDA_VERBOSE) printfQuda("Using counter-based Philox4x32-10\n");
+      return;
+    }
+
+    state = std::shared_ptr<RNGState>((RNGState *)device_malloc(size * sizeof(RNGState)),
+                                      [](RNGState *ptr) { device_free(ptr); });
+    accessor.state = state.get();
+
 #if defined(XORWOW)
     if (getVerbosity() >= QUDA_VERBOSE) printfQuda("Using randStateXORWOW\n");
 #elif defined(RG32k3a)
@@ -51,12 +89,23 @@ namespace quda {
       printfQuda("Allocated array of random numbers with size: %.2f MB\n",
                  size * sizeof(RNGState) / (float)(1048576));
 
-    RNGInit(*this, meta, seed);
+    RNGInit(*this, meta);
+  }
+
+  RNGAccessor RNG::Accessor()
+  {
+    RNGAccessor rng = accessor;
+    if (type == RNGType::COUNTER) accessor.counter++;
+    return rng;
   }
 
   /*! @brief Backup CURAND array states initialization */
   void RNG::backup()
   {
+    if (type == RNGType::COUNTER) {
+      backup_counter = accessor.counter;
+      return;
+    }
     backup_state = (RNGState *)safe_malloc(size * sizeof(RNGState));
     qudaMemcpy(backup_state, state.get(), size * sizeof(RNGState), qudaMemcpyDeviceToHost);
   }
@@ -64,6 +113,10 @@ namespace quda {
   /*! @brief Restore CURAND array states initialization */
   void RNG::restore()
   {
+    if (type == RNGType::COUNTER) {
+      accessor.counter = backup_counter;
+      return;
+    }
     qudaMemcpy(state.get(), backup_state, size * sizeof(RNGState), qudaMemcpyHostToDevice);
     host_free(backup_state);
   }
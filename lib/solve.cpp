@@ -1,3 +1,4 @@
+#include <list>
 #include "invert_quda.h"
 
 namespace quda
@@ -125,8 +126,196 @@ namespace quda
     }
   }
 
+  void createDiracWithEig(Dirac *&d, Dirac *&dSloppy, Dirac *&dPre, Dirac *&dEig, QudaInvertParam &param,
+                          const bool pc_solve);
+
+  namespace
+  {
+
+    /**
+       A set of Dirac operators, and the solver built on top of them,
+       that is retained between calls to solve with matching
+       parameters.  Members are destroyed in reverse order, so the
+       solver goes before the operators it references.
+    */
+    struct SolverCacheEntry {
+      QudaInvertParam key;
+      std::unique_ptr<Dirac> dirac;
+      std::unique_ptr<Dirac> diracSloppy;
+      std::unique_ptr<Dirac> diracPre;
+      std::unique_ptr<Dirac> diracEig;
+      std::unique_ptr<DiracMatrix> m;
+      std::unique_ptr<DiracMatrix> mSloppy;
+      std::unique_ptr<DiracMatrix> mPre;
+      std::unique_ptr<DiracMatrix> mEig;
+      std::unique_ptr<SolverParam> solverParam;
+      std::unique_ptr<Solver> solver;
+
+      /**
+         @brief Return the retained solver, creating it on first use.
+         Since the solve and solution types are part of the key, the
+         operator type is fixed for a given entry.  On reuse only the
+         per-call parameters are refreshed, so that any state the
+         solver keeps in its SolverParam (e.g., CA eigenvalue
+         estimates) carries over.
+         @param[in] param Parameters for this solve
+         @return The solver
+      */
+      template <typename Matrix> Solver &get(const QudaInvertParam &param)
+      {
+        if (!solver) {
+          m = std::make_unique<Matrix>(*dirac);
+          mSloppy = std::make_unique<Matrix>(*diracSloppy);
+          mPre = std::make_unique<Matrix>(*diracPre);
+          mEig = std::make_unique<Matrix>(*diracEig);
+          solverParam = std::make_unique<SolverParam>(param);
+          solver.reset(Solver::create(*solverParam, *m, *mSloppy, *mPre, *mEig));
+        } else {
+          solverParam->tol = param.tol;
+          solverParam->tol_restart = param.tol_restart;
+          solverParam->tol_hq = param.tol_hq;
+          solverParam->maxiter = param.maxiter;
+          solverParam->use_init_guess = param.use_init_guess;
+          solverParam->iter = param.iter;
+          std::fill(solverParam->true_res.begin(), solverParam->true_res.end(), 0.0);
+          std::fill(solverParam->true_res_hq.begin(), solverParam->true_res_hq.end(), 0.0);
+        }
+        return *solver;
+      }
+    };
+
+    /** Cached entries, most recently used at the front */
+    std::list<SolverCacheEntry> solverCache;
+
+    /**
+       @return The maximum number of cached solver entries, set with
+       QUDA_ENABLE_SOLVER_CACHE (default 0, which disables the cache)
+    */
+    size_t solverCacheSize()
+    {
+      static bool init = false;
+      static size_t size = 0;
+
+      if (!init) {
+        char *size_str = getenv("QUDA_ENABLE_SOLVER_CACHE");
+        if (size_str) {
+          int n = atoi(size_str);
+          if (n < 0) errorQuda("QUDA_ENABLE_SOLVER_CACHE=%d cannot be negative", n);
+          size = n;
+          logQuda(QUDA_SUMMARIZE, "QUDA_ENABLE_SOLVER_CACHE set to %d\n", n);
+        }
+        init = true;
+      }
+
+      return size;
+    }
+
+    /**
+       @brief Construct the cache key for a solve: a copy of the
+       invert param with the solver outputs, the per-call parameters
+       that are refreshed on reuse, and the fields that do not affect
+       the operators or solver zeroed.  The resident gauge and clover
+       fields are not part of the key, since any change to them
+       flushes the cache.
+    */
+    QudaInvertParam solverCacheKey(const QudaInvertParam &param)
+    {
+      QudaInvertParam key;
+      memcpy(&key, &param, sizeof(key));
+
+      // solver outputs
+      memset(key.true_res, 0, sizeof(key.true_res));
+      memset(key.true_res_hq, 0, sizeof(key.true_res_hq));
+      memset(key.true_res_offset, 0, sizeof(key.true_res_offset));
+      memset(key.iter_res_offset, 0, sizeof(key.iter_res_offset));
+      memset(key.true_res_hq_offset, 0, sizeof(key.true_res_hq_offset));
+      memset(key.action, 0, sizeof(key.action));
+      memset(key.trlogA, 0, sizeof(key.trlogA));
+      key.iter = 0;
+      key.gflops = 0.0;
+      key.secs = 0.0;
+      key.energy = 0.0;
+      key.power = 0.0;
+      key.temp = 0.0;
+      key.clock = 0.0;
+      key.rhs_idx = 0;
+      key.ca_lambda_min = 0.0;
+      key.ca_lambda_max = 0.0;
+      key.ca_lambda_min_precondition = 0.0;
+      key.ca_lambda_max_precondition = 0.0;
+
+      // per-call parameters
+      key.tol = 0.0;
+      key.tol_restart = 0.0;
+      key.tol_hq = 0.0;
+      key.maxiter = 0;
+      key.use_init_guess = QUDA_USE_INIT_GUESS_NO;
+      key.verbosity = QUDA_SILENT;
+
+      // host field layout and solution forecasting
+      key.input_location = QUDA_INVALID_FIELD_LOCATION;
+      key.output_location = QUDA_INVALID_FIELD_LOCATION;
+      key.make_resident_solution = 0;
+      key.use_resident_solution = 0;
+      key.chrono_make_resident = 0;
+      key.chrono_replace_last = 0;
+      key.chrono_use_resident = 0;
+      key.chrono_max_dim = 0;
+      key.chrono_index = 0;
+      key.chrono_precision = QUDA_INVALID_PRECISION;
+
+      return key;
+    }
+
+    /**
+       @brief Find the cache entry matching param, creating its Dirac
+       operators if there is none, and evicting the least recently
+       used entry if the cache is full.
+       @param[in] param Parameters for this solve
+       @param[in] pc_solve Whether this is a preconditioned solve
+       @return The cache entry
+    */
+    SolverCacheEntry &getSolverCacheEntry(QudaInvertParam &param, bool pc_solve)
+    {
+      auto key = solverCacheKey(param);
+
+      for (auto it = solverCache.begin(); it != solverCache.end(); it++) {
+        if (memcmp(&it->key, &key, sizeof(key)) == 0) {
+          logQuda(QUDA_DEBUG_VERBOSE, "Reusing cached Dirac operators and solver\n");
+          solverCache.splice(solverCache.begin(), solverCache, it);
+          return solverCache.front();
+        }
+      }
+
+      // evict first so that at most solverCacheSize() sets of operators are ever live
+      while (solverCache.size() >= solverCacheSize()) solverCache.pop_back();
+
+      logQuda(QUDA_DEBUG_VERBOSE, "Creating cached Dirac operators (%lu entries cached)\n", solverCache.size());
+      Dirac *dirac = nullptr;
+      Dirac *diracSloppy = nullptr;
+      Dirac *diracPre = nullptr;
+      Dirac *diracEig = nullptr;
+      createDiracWithEig(dirac, diracSloppy, diracPre, diracEig, param, pc_solve);
+
+      auto &entry = solverCache.emplace_front();
+      entry.key = key;
+      entry.dirac.reset(dirac);
+      entry.diracSloppy.reset(diracSloppy);
+      entry.diracPre.reset(diracPre);
+      entry.diracEig.reset(diracEig);
+      return entry;
+    }
+
+  } // namespace
+
+  void flushSolverCache()
+  {
+    if (solverCache.size()) logQuda(QUDA_DEBUG_VERBOSE, "Flushing %lu cached solvers\n", solverCache.size());
+    solverCache.clear();
+  }
+
   void solve(cvector_ref<ColorSpinorField> &x, cvector_ref<ColorSpinorField> &b, Dirac &dirac, Dirac &diracSloppy,
-             Dirac &diracPre, Dirac &diracEig, QudaInvertParam &param)
+             Dirac &diracPre, Dirac &diracEig, QudaInvertParam &param, SolverCacheEntry *cache = nullptr)
   {
     getProfile().TPSTART(QUDA_PROFILE_PREAMBLE);
 
@@ -220,13 +409,18 @@ namespace quda
       if (param.chrono_use_resident && chronoResident[param.chrono_index].size() > 0) {
         bool hermitian = false;
         auto &mChrono = param.chrono_precision == param.cuda_prec ? m : mSloppy;
-        chronoExtrapolate(out[0], in[0], chronoResident[param.chrono_index], mChrono, hermitian);
+        chronoExtrapolate(out, in, chronoResident[param.chrono_index], mChrono, hermitian);
       }
 
-      Solver *solve = Solver::create(solverParam, m, mSloppy, mPre, mEig);
-      (*solve)(out, in);
-      delete solve;
-      solverParam.updateInvertParam(param);
+      if (cache) {
+        cache->get<DiracM>(param)(out, in);
+        cache->solverParam->updateInvertParam(param);
+      } else {
+        Solver *solve = Solver::create(solverParam, m, mSloppy, mPre, mEig);
+        (*solve)(out, in);
+        delete solve;
+        solverParam.updateInvertParam(param);
+      }
     } else if (!norm_error_solve) {
       DiracMdagM m(dirac), mSloppy(diracSloppy), mPre(diracPre), mEig(diracEig);
       SolverParam solverParam(param);
@@ -235,7 +429,7 @@ namespace quda
       if (param.chrono_use_resident && chronoResident[param.chrono_index].size() > 0) {
         bool hermitian = true;
         auto &mChrono = param.chrono_precision == param.cuda_prec ? m : mSloppy;
-        chronoExtrapolate(out[0], in[0], chronoResident[param.chrono_index], mChrono, hermitian);
+        chronoExtrapolate(out, in, chronoResident[param.chrono_index], mChrono, hermitian);
       }
 
       // if using a Schwarz preconditioner with a normal operator then we must use the DiracMdagMLocal operator
@@ -245,6 +439,9 @@ namespace quda
         (*solve)(out, in);
         delete solve;
         solverParam.updateInvertParam(param);
+      } else if (cache) {
+        cache->get<DiracMdagM>(param)(out, in);
+        cache->solverParam->updateInvertParam(param);
       } else {
         Solver *solve = Solver::create(solverParam, m, mSloppy, mPre, mEig);
         (*solve)(out, in);
@@ -279,18 +476,24 @@ namespace quda
                   basis.size());
       }
 
+      // the basis is shared by all right hand sides, with the newest solutions at the front
+      const int n_new = std::min(static_cast<int>(out.size()), param.chrono_max_dim);
+
       if (not param.chrono_replace_last) {
         // if we have not filled the space yet just augment
-        if ((int)basis.size() < param.chrono_max_dim) {
-          ColorSpinorParam cs_param(out[0]);
-          cs_param.setPrecision(param.chrono_precision);
-          basis.emplace_back(cs_param);
-        }
-
-        // shuffle every entry down one and bring the last to the front
-        std::rotate(basis.begin(), basis.end() - 1, basis.end());
+        ColorSpinorParam cs_param(out[0]);
+        cs_param.setPrecision(param.chrono_precision);
+        const int n_basis = std::min(param.chrono_max_dim, (int)basis.size() + n_new);
+        while ((int)basis.size() < n_basis) basis.emplace_back(cs_param);
+
+        // shuffle every entry down n_new and bring the last n_new to the front
+        std::rotate(basis.begin(), basis.end() - n_new, basis.end());
+      } else if ((int)basis.size() < n_new) {
+        ColorSpinorParam cs_param(out[0]);
+        cs_param.setPrecision(param.chrono_precision);
+        while ((int)basis.size() < n_new) basis.emplace_back(cs_param);
       }
-      basis[0] = out[0]; // set first entry to new solution
+      for (int k = 0; k < n_new; k++) basis[k] = out[k]; // set first entries to the new solutions
     }
 
     dirac.reconstruct(x, b, param.solution_type);
@@ -317,9 +520,6 @@ namespace quda
     getProfile().TPSTOP(QUDA_PROFILE_EPILOGUE);
   }
 
-  void createDiracWithEig(Dirac *&d, Dirac *&dSloppy, Dirac *&dPre, Dirac *&dEig, QudaInvertParam &param,
-                          const bool pc_solve);
-
   extern std::vector<ColorSpinorField> solutionResident;
 
   void solve(const std::vector<void *> &hp_x, const std::vector<void *> &hp_b, QudaInvertParam &param,
@@ -348,8 +548,16 @@ namespace quda
     Dirac *diracEig = nullptr;
 
     // Create the dirac operator and operators for sloppy, precondition,
-    // and an eigensolver
-    createDiracWithEig(dirac, diracSloppy, diracPre, diracEig, param, pc_solve);
+    // and an eigensolver, or reuse those from a previous matching solve
+    SolverCacheEntry *cache = solverCacheSize() > 0 ? &getSolverCacheEntry(param, pc_solve) : nullptr;
+    if (cache) {
+      dirac = cache->dirac.get();
+      diracSloppy = cache->diracSloppy.get();
+      diracPre = cache->diracPre.get();
+      diracEig = cache->diracEig.get();
+    } else {
+      createDiracWithEig(dirac, diracSloppy, diracPre, diracEig, param, pc_solve);
+    }
 
     // wrap CPU host side pointers
     ColorSpinorParam cpuParam(hp_b[0], param, u.X(), pc_solution, param.input_location);
@@ -406,14 +614,16 @@ namespace quda
       blas::zero(x);
     }
 
-    solve(x, b, *dirac, *diracSloppy, *diracPre, *diracEig, param);
+    solve(x, b, *dirac, *diracSloppy, *diracPre, *diracEig, param, cache);
 
     if (!param.make_resident_solution) blas::copy(h_x, x);
 
-    delete dirac;
-    delete diracSloppy;
-    delete diracPre;
-    delete diracEig;
+    if (!cache) {
+      delete dirac;
+      delete diracSloppy;
+      delete diracPre;
+      delete diracEig;
+    }
 
     popVerbosity();
   }
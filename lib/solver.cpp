@@ -91,6 +91,10 @@ namespace quda {
       report("CA-GCR");
       solver = new CAGCR(mat, matSloppy, matPrecon, matEig, param);
       break;
+    case QUDA_PIPELINED_CG_INVERTER:
+      report("Pipelined CG");
+      solver = new PipelinedCG(mat, matSloppy, matPrecon, matEig, param);
+      break;
     case QUDA_MR_INVERTER:
       report("MR");
       solver = new MR(mat, matSloppy, param);
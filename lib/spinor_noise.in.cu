@@ -28,10 +28,10 @@ namespace quda {
       TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity());
       switch (type) {
       case QUDA_NOISE_GAUSS:
-        launch<NoiseSpinor>(tp, stream, SpinorNoiseArg<real, Ns, Nc, QUDA_NOISE_GAUSS>(v, rng.State()));
+        launch<NoiseSpinor>(tp, stream, SpinorNoiseArg<real, Ns, Nc, QUDA_NOISE_GAUSS>(v, rng.Accessor()));
         break;
       case QUDA_NOISE_UNIFORM:
-        launch<NoiseSpinor>(tp, stream, SpinorNoiseArg<real, Ns, Nc, QUDA_NOISE_UNIFORM>(v, rng.State()));
+        launch<NoiseSpinor>(tp, stream, SpinorNoiseArg<real, Ns, Nc, QUDA_NOISE_UNIFORM>(v, rng.Accessor()));
         break;
       default: errorQuda("Noise type %d not implemented", type);
       }
@@ -23,29 +23,72 @@ namespace quda
 
       // Batched inversion ckecking
       //---------------------------------------------------
-      template <typename EigenMatrix, typename Float>
-      void invertEigen(std::complex<Float> *A_eig, std::complex<Float> *Ainv_eig, int n, uint64_t batch)
+      /**
+         Largest matrix size inverted with fixed-size storage.  Each
+         OpenMP thread holds several n x n temporaries on its stack, so
+         larger matrices use heap-allocated dynamic-size storage, where
+         the O(n^3) work dwarfs the allocation anyway.
+       */
+      constexpr int max_fixed_size = 24;
+
+      /**
+         @brief Invert matrix batch of the column-major array A_eig into
+         Ainv_eig.  Hermitian positive-definite matrices (e.g., chiral
+         clover blocks) are inverted with a Cholesky factorization,
+         everything else with a partial-pivoting LU.
+         @tparam Float Underlying real precision
+         @tparam N Compile-time matrix size (at most max_fixed_size), or Dynamic
+       */
+      template <typename Float, int N>
+      void invertEigen(const std::complex<Float> *A_eig, std::complex<Float> *Ainv_eig, int n, uint64_t batch)
       {
-        EigenMatrix res = EigenMatrix::Zero(n, n);
-        EigenMatrix inv = EigenMatrix::Zero(n, n);
-        for (int j = 0; j < n; j++) {
-          for (int k = 0; k < n; k++) { res(k, j) = A_eig[batch * n * n + j * n + k]; }
-        }
-
-        inv = res.inverse();
-
-        for (int j = 0; j < n; j++) {
-          for (int k = 0; k < n; k++) { Ainv_eig[batch * n * n + j * n + k] = inv(k, j); }
+        static_assert(N == Dynamic || N <= max_fixed_size, "fixed-size matrix too large for the thread stack");
+        using matrix_t = Matrix<std::complex<Float>, N, N>;
+        Map<const matrix_t> A(A_eig + batch * n * n, n, n);
+        Map<matrix_t> Ainv(Ainv_eig + batch * n * n, n, n);
+
+        // local copy so that in-place inversion (A_eig == Ainv_eig) is safe
+        const matrix_t res = A;
+
+        bool done = false;
+        if (res.isApprox(res.adjoint(), 16 * std::numeric_limits<Float>::epsilon())) {
+          LLT<matrix_t> llt(res);
+          if (llt.info() == Success) {
+            Ainv = llt.solve(matrix_t::Identity(n, n));
+            done = true;
+          }
         }
+        if (!done) Ainv = res.partialPivLu().inverse();
 
         // Check result:
 #ifdef _DEBUG
-        EigenMatrix unit = EigenMatrix::Identity(n, n);
-        EigenMatrix prod = res * inv;
+        matrix_t unit = matrix_t::Identity(n, n);
+        matrix_t prod = res * Ainv;
         Float L2norm = ((prod - unit).norm() / (n * n));
         printfQuda("Eigen: Norm of (A * Ainv - I) batch %lu = %e\n", batch, L2norm);
 #endif
       }
+
+      template <typename Float>
+      using inverter_t = void (*)(const std::complex<Float> *, std::complex<Float> *, int, uint64_t);
+
+      /**
+         @brief Return the inverter for a given matrix size.  The small
+         sizes QUDA issues in practice use a fixed-size (stack allocated,
+         unrolled) instantiation, everything else (including the 48 x 48
+         staggered KD Xinv and 64 x 64 coarse clover blocks) the
+         dynamic-size one.
+         @param[in] n Matrix size
+       */
+      template <typename Float> inverter_t<Float> get_inverter(int n)
+      {
+        switch (n) {
+        case 6: return invertEigen<Float, 6>;   // chiral clover blocks
+        case 12: return invertEigen<Float, 12>; // coarse clover, N_vec = 6
+        case 24: return invertEigen<Float, 24>; // coarse clover, N_vec = 12
+        default: return invertEigen<Float, Dynamic>;
+        }
+      }
       //---------------------------------------------------
 
       // Batched Inversions
@@ -69,19 +112,21 @@ namespace quda
           std::complex<float> *A_eig = (std::complex<float> *)A_h;
           std::complex<float> *Ainv_eig = (std::complex<float> *)Ainv_h;
 
+          auto invert = get_inverter<float>(n);
 #ifdef _OPENMP
 #pragma omp parallel for
 #endif
-          for (uint64_t i = 0; i < batch; i++) { invertEigen<MatrixXcf, float>(A_eig, Ainv_eig, n, i); }
+          for (uint64_t i = 0; i < batch; i++) { invert(A_eig, Ainv_eig, n, i); }
           flops += batch * FLOPS_CGETRF(n, n);
         } else if (prec == QUDA_DOUBLE_PRECISION) {
           std::complex<double> *A_eig = (std::complex<double> *)A_h;
           std::complex<double> *Ainv_eig = (std::complex<double> *)Ainv_h;
 
+          auto invert = get_inverter<double>(n);
 #ifdef _OPENMP
 #pragma omp parallel for
 #endif
-          for (uint64_t i = 0; i < batch; i++) { invertEigen<MatrixXcd, double>(A_eig, Ainv_eig, n, i); }
+          for (uint64_t i = 0; i < batch; i++) { invert(A_eig, Ainv_eig, n, i); }
           flops += batch * FLOPS_ZGETRF(n, n);
         } else {
           errorQuda("%s not implemented for precision = %d", __func__, prec);
@@ -95,107 +140,189 @@ namespace quda
         if (getVerbosity() >= QUDA_VERBOSE) {
           int threads = 1;
 #ifdef _OPENMP
-          threads = omp_get_num_threads();
+          threads = omp_get_max_threads();
 #endif
           printfQuda("CPU: Batched matrix inversion completed in %f seconds using %d threads with GFLOPS = %f\n", timeh,
                      threads, 1e-9 * flops / timeh);
         }
 
         if (location == QUDA_CUDA_FIELD_LOCATION) {
+          qudaMemcpy((void *)Ainv, Ainv_h, size, qudaMemcpyHostToDevice);
           pool_pinned_free(Ainv_h);
           pool_pinned_free(A_h);
-          qudaMemcpy((void *)Ainv, Ainv_h, size, qudaMemcpyHostToDevice);
         }
 
         return flops;
       }
 
-      // Srided Batched GEMM helpers
+      // Strided Batched GEMM helpers
       //--------------------------------------------------------------------------
-      template <typename EigenMat, typename T>
-      void fillArray(EigenMat &EigenArr, T *arr, int rows, int cols, int ld, int offset, bool fill_eigen)
+
+      /**
+         Row-major in-place view of a single matrix in a strided batch
+         array.  The leading dimension is the outer stride, so no data
+         is copied.  Rows and Cols are set to compile-time values for
+         the small fixed-size kernels, and Dynamic otherwise.
+       */
+      template <typename T, int Rows = Dynamic, int Cols = Dynamic>
+      using MapMatrix = Map<Matrix<T, Rows, Cols, RowMajor>, Unaligned, OuterStride<>>;
+
+      template <typename T, int Rows = Dynamic, int Cols = Dynamic>
+      using ConstMapMatrix = Map<const Matrix<T, Rows, Cols, RowMajor>, Unaligned, OuterStride<>>;
+
+      /**
+         @brief Apply op(X) to a mapped matrix, returning a lightweight
+         Eigen expression (no temporary is formed).
+       */
+      template <QudaBLASOperation op, typename Mat> auto blas_op(const Mat &X)
       {
-        int counter = offset;
-        for (int i = 0; i < rows; i++) {
-          for (int j = 0; j < cols; j++) {
-            if (fill_eigen)
-              EigenArr(i, j) = arr[counter];
-            else
-              arr[counter] = EigenArr(i, j);
-            counter++;
-          }
-          counter += (ld - cols);
-        }
+        if constexpr (op == QUDA_BLAS_OP_T)
+          return X.transpose();
+        else if constexpr (op == QUDA_BLAS_OP_C)
+          return X.adjoint();
+        else
+          return X;
       }
 
-      template <typename EigenMat, typename T>
-      void GEMM(void *A_h, void *B_h, void *C_h, T alpha, T beta, int max_stride, QudaBLASParam &blas_param)
+      /**
+         Per-call geometry of the strided batch, expressed in elements
+         (not bytes) and after any row/column swap has been applied.
+       */
+      struct GEMMBatch {
+        int m;
+        int n;
+        int k;
+        int lda;
+        int ldb;
+        int ldc;
+        int64_t a_offset;
+        int64_t b_offset;
+        int64_t c_offset;
+        int64_t a_batch; // elements between consecutive A matrices
+        int64_t b_batch; // elements between consecutive B matrices
+        int64_t c_batch; // elements between consecutive C matrices
+        int64_t batches; // number of GEMMs to compute
+
+        GEMMBatch(const QudaBLASParam &blas_param, int max_stride) :
+          m(blas_param.m),
+          n(blas_param.n),
+          k(blas_param.k),
+          lda(blas_param.lda),
+          ldb(blas_param.ldb),
+          ldc(blas_param.ldc),
+          a_offset(blas_param.a_offset),
+          b_offset(blas_param.b_offset),
+          c_offset(blas_param.c_offset)
+        {
+          // If the user did not set any stride values, we default them to 1
+          // as batch size 0 is an option.
+          int64_t a_stride = blas_param.a_stride == 0 ? 1 : blas_param.a_stride;
+          int64_t b_stride = blas_param.b_stride == 0 ? 1 : blas_param.b_stride;
+          int64_t c_stride = blas_param.c_stride == 0 ? 1 : blas_param.c_stride;
+
+          // Number of data between batches
+          int64_t A_batch_size = static_cast<int64_t>(lda) * (blas_param.trans_a == QUDA_BLAS_OP_N ? k : m);
+          int64_t B_batch_size = static_cast<int64_t>(ldb) * (blas_param.trans_b == QUDA_BLAS_OP_N ? n : k);
+          int64_t C_batch_size = static_cast<int64_t>(ldc) * n;
+
+          a_batch = A_batch_size * a_stride;
+          b_batch = B_batch_size * b_stride;
+          c_batch = C_batch_size * c_stride;
+          batches = (blas_param.batch_count + max_stride - 1) / max_stride;
+        }
+      };
+
+      /**
+         @brief Compute C_i = alpha * op(A_i) * op(B_i) + beta * C_i for
+         every batch i, with A_i, B_i and C_i mapped in place.  Batches
+         are distributed over the OpenMP threads.  As with the native
+         BLAS, C must not alias A or B.
+         @tparam T Data type
+         @tparam M Compile-time m (or Dynamic)
+         @tparam N Compile-time n (or Dynamic)
+         @tparam K Compile-time k (or Dynamic)
+         @tparam op_a Operation applied to A
+         @tparam op_b Operation applied to B
+       */
+      template <typename T, int M, int N, int K, QudaBLASOperation op_a, QudaBLASOperation op_b>
+      void GEMMKernel(const T *A_ptr, const T *B_ptr, T *C_ptr, T alpha, T beta, const GEMMBatch &p)
       {
-        // Problem parameters
-        int m = blas_param.m;
-        int n = blas_param.n;
-        int k = blas_param.k;
-        int lda = blas_param.lda;
-        int ldb = blas_param.ldb;
-        int ldc = blas_param.ldc;
-
-        // If the user did not set any stride values, we default them to 1
-        // as batch size 0 is an option.
-        int a_stride = blas_param.a_stride == 0 ? 1 : blas_param.a_stride;
-        int b_stride = blas_param.b_stride == 0 ? 1 : blas_param.b_stride;
-        int c_stride = blas_param.c_stride == 0 ? 1 : blas_param.c_stride;
-        int a_offset = blas_param.a_offset;
-        int b_offset = blas_param.b_offset;
-        int c_offset = blas_param.c_offset;
-        int batches = blas_param.batch_count;
-
-        // Number of data between batches
-        unsigned int A_batch_size = blas_param.lda * blas_param.k;
-        if (blas_param.trans_a != QUDA_BLAS_OP_N) A_batch_size = blas_param.lda * blas_param.m;
-        unsigned int B_batch_size = blas_param.ldb * blas_param.n;
-        if (blas_param.trans_b != QUDA_BLAS_OP_N) B_batch_size = blas_param.ldb * blas_param.k;
-        unsigned int C_batch_size = blas_param.ldc * blas_param.n;
-
-        T *A_ptr = (T *)(&A_h)[0];
-        T *B_ptr = (T *)(&B_h)[0];
-        T *C_ptr = (T *)(&C_h)[0];
+        constexpr int A_rows = op_a == QUDA_BLAS_OP_N ? M : K;
+        constexpr int A_cols = op_a == QUDA_BLAS_OP_N ? K : M;
+        constexpr int B_rows = op_b == QUDA_BLAS_OP_N ? K : N;
+        constexpr int B_cols = op_b == QUDA_BLAS_OP_N ? N : K;
+        const int a_rows = op_a == QUDA_BLAS_OP_N ? p.m : p.k;
+        const int a_cols = op_a == QUDA_BLAS_OP_N ? p.k : p.m;
+        const int b_rows = op_b == QUDA_BLAS_OP_N ? p.k : p.n;
+        const int b_cols = op_b == QUDA_BLAS_OP_N ? p.n : p.k;
+        const bool zero_beta = (beta == T(0));
 
-        // Eigen objects to store data
-        EigenMat Amat = EigenMat::Zero(m, k);
-        EigenMat Bmat = EigenMat::Zero(k, n);
-        EigenMat Cmat = EigenMat::Zero(m, n);
-
-        for (int batch = 0; batch < batches; batch += max_stride) {
-
-          // Populate Eigen objects
-          fillArray<EigenMat, T>(Amat, A_ptr, m, k, lda, a_offset, true);
-          fillArray<EigenMat, T>(Bmat, B_ptr, k, n, ldb, b_offset, true);
-          fillArray<EigenMat, T>(Cmat, C_ptr, m, n, ldc, c_offset, true);
-
-          // Apply op(A) and op(B)
-          switch (blas_param.trans_a) {
-          case QUDA_BLAS_OP_T: Amat.transposeInPlace(); break;
-          case QUDA_BLAS_OP_C: Amat.adjointInPlace(); break;
-          case QUDA_BLAS_OP_N: break;
-          default: errorQuda("Unknown blas op type %d", blas_param.trans_a);
-          }
-
-          switch (blas_param.trans_b) {
-          case QUDA_BLAS_OP_T: Bmat.transposeInPlace(); break;
-          case QUDA_BLAS_OP_C: Bmat.adjointInPlace(); break;
-          case QUDA_BLAS_OP_N: break;
-          default: errorQuda("Unknown blas op type %d", blas_param.trans_b);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for (int64_t batch = 0; batch < p.batches; batch++) {
+          ConstMapMatrix<T, A_rows, A_cols> A(A_ptr + p.a_offset + batch * p.a_batch, a_rows, a_cols,
+                                              OuterStride<>(p.lda));
+          ConstMapMatrix<T, B_rows, B_cols> B(B_ptr + p.b_offset + batch * p.b_batch, b_rows, b_cols,
+                                              OuterStride<>(p.ldb));
+          MapMatrix<T, M, N> C(C_ptr + p.c_offset + batch * p.c_batch, p.m, p.n, OuterStride<>(p.ldc));
+
+          if (zero_beta) {
+            C.noalias() = alpha * (blas_op<op_a>(A) * blas_op<op_b>(B));
+          } else {
+            C *= beta;
+            C.noalias() += alpha * (blas_op<op_a>(A) * blas_op<op_b>(B));
           }
+        }
+      }
 
-          // Perform GEMM using Eigen
-          Cmat = alpha * Amat * Bmat + beta * Cmat;
+      template <typename T, int M, int N, int K, QudaBLASOperation op_a>
+      void GEMMKernel(const T *A_ptr, const T *B_ptr, T *C_ptr, T alpha, T beta, const GEMMBatch &p,
+                      QudaBLASOperation op_b)
+      {
+        switch (op_b) {
+        case QUDA_BLAS_OP_N: GEMMKernel<T, M, N, K, op_a, QUDA_BLAS_OP_N>(A_ptr, B_ptr, C_ptr, alpha, beta, p); break;
+        case QUDA_BLAS_OP_T: GEMMKernel<T, M, N, K, op_a, QUDA_BLAS_OP_T>(A_ptr, B_ptr, C_ptr, alpha, beta, p); break;
+        case QUDA_BLAS_OP_C: GEMMKernel<T, M, N, K, op_a, QUDA_BLAS_OP_C>(A_ptr, B_ptr, C_ptr, alpha, beta, p); break;
+        default: errorQuda("Unknown blas op type %d", op_b);
+        }
+      }
 
-          // Write back to the C array
-          fillArray<EigenMat, T>(Cmat, C_ptr, m, n, ldc, c_offset, false);
+      template <typename T, int M, int N, int K>
+      void GEMMKernel(const T *A_ptr, const T *B_ptr, T *C_ptr, T alpha, T beta, const GEMMBatch &p,
+                      QudaBLASOperation op_a, QudaBLASOperation op_b)
+      {
+        switch (op_a) {
+        case QUDA_BLAS_OP_N: GEMMKernel<T, M, N, K, QUDA_BLAS_OP_N>(A_ptr, B_ptr, C_ptr, alpha, beta, p, op_b); break;
+        case QUDA_BLAS_OP_T: GEMMKernel<T, M, N, K, QUDA_BLAS_OP_T>(A_ptr, B_ptr, C_ptr, alpha, beta, p, op_b); break;
+        case QUDA_BLAS_OP_C: GEMMKernel<T, M, N, K, QUDA_BLAS_OP_C>(A_ptr, B_ptr, C_ptr, alpha, beta, p, op_b); break;
+        default: errorQuda("Unknown blas op type %d", op_a);
+        }
+      }
 
-          a_offset += A_batch_size * a_stride;
-          b_offset += B_batch_size * b_stride;
-          c_offset += C_batch_size * c_stride;
+      /**
+         @brief Host GEMM engine: dispatch to a fixed-size kernel for
+         the small square shapes that QUDA issues (SU(3) links, chiral
+         clover blocks, Wilson spinor matrices and typical multigrid
+         null-space counts), falling back to dynamic-size maps.
+       */
+      template <typename T>
+      void GEMM(void *A_h, void *B_h, void *C_h, T alpha, T beta, int max_stride, const QudaBLASParam &blas_param)
+      {
+        GEMMBatch p(blas_param, max_stride);
+        auto A_ptr = static_cast<const T *>(A_h);
+        auto B_ptr = static_cast<const T *>(B_h);
+        auto C_ptr = static_cast<T *>(C_h);
+        auto op_a = blas_param.trans_a;
+        auto op_b = blas_param.trans_b;
+
+        int size = (p.m == p.n && p.n == p.k) ? p.m : 0;
+        switch (size) {
+        case 3: GEMMKernel<T, 3, 3, 3>(A_ptr, B_ptr, C_ptr, alpha, beta, p, op_a, op_b); break;
+        case 6: GEMMKernel<T, 6, 6, 6>(A_ptr, B_ptr, C_ptr, alpha, beta, p, op_a, op_b); break;
+        case 12: GEMMKernel<T, 12, 12, 12>(A_ptr, B_ptr, C_ptr, alpha, beta, p, op_a, op_b); break;
+        case 24: GEMMKernel<T, 24, 24, 24>(A_ptr, B_ptr, C_ptr, alpha, beta, p, op_a, op_b); break;
+        default: GEMMKernel<T, Dynamic, Dynamic, Dynamic>(A_ptr, B_ptr, C_ptr, alpha, beta, p, op_a, op_b);
         }
       }
       //---------------------------------------------------
@@ -333,7 +460,7 @@ namespace quda
           typedef std::complex<double> Z;
           const Z alpha = blas_param.alpha;
           const Z beta = blas_param.beta;
-          GEMM<MatrixXcd, Z>(A_h, B_h, C_h, alpha, beta, max_stride, blas_param);
+          GEMM<Z>(A_h, B_h, C_h, alpha, beta, max_stride, blas_param);
           flops += batch * FLOPS_CGEMM(blas_param.m, blas_param.n, blas_param.k);
 
         } else if (blas_param.data_type == QUDA_BLAS_DATATYPE_C) {
@@ -341,7 +468,7 @@ namespace quda
           typedef std::complex<float> C;
           const C alpha = blas_param.alpha;
           const C beta = blas_param.beta;
-          GEMM<MatrixXcf, C>(A_h, B_h, C_h, alpha, beta, max_stride, blas_param);
+          GEMM<C>(A_h, B_h, C_h, alpha, beta, max_stride, blas_param);
           flops += batch * FLOPS_CGEMM(blas_param.m, blas_param.n, blas_param.k);
 
         } else if (blas_param.data_type == QUDA_BLAS_DATATYPE_D) {
@@ -349,7 +476,7 @@ namespace quda
           typedef double D;
           const D alpha = (D)(static_cast<std::complex<double>>(blas_param.alpha).real());
           const D beta = (D)(static_cast<std::complex<double>>(blas_param.beta).real());
-          GEMM<MatrixXd, D>(A_h, B_h, C_h, alpha, beta, max_stride, blas_param);
+          GEMM<D>(A_h, B_h, C_h, alpha, beta, max_stride, blas_param);
           flops += batch * FLOPS_SGEMM(blas_param.m, blas_param.n, blas_param.k);
 
         } else if (blas_param.data_type == QUDA_BLAS_DATATYPE_S) {
@@ -357,7 +484,7 @@ namespace quda
           typedef float S;
           const S alpha = (S)(static_cast<std::complex<float>>(blas_param.alpha).real());
           const S beta = (S)(static_cast<std::complex<float>>(blas_param.beta).real());
-          GEMM<MatrixXf, S>(A_h, B_h, C_h, alpha, beta, max_stride, blas_param);
+          GEMM<S>(A_h, B_h, C_h, alpha, beta, max_stride, blas_param);
           flops += batch * FLOPS_SGEMM(blas_param.m, blas_param.n, blas_param.k);
 
         } else {
@@ -387,8 +514,14 @@ namespace quda
         long ds = stop.tv_sec - start.tv_sec;
         long dus = stop.tv_usec - start.tv_usec;
         double time = ds + 0.000001 * dus;
-        if (getVerbosity() >= QUDA_DEBUG_VERBOSE)
-          printfQuda("Batched matrix GEMM completed in %f seconds with GFLOPS = %f\n", time, 1e-9 * flops / time);
+        if (getVerbosity() >= QUDA_VERBOSE) {
+          int threads = 1;
+#ifdef _OPENMP
+          threads = omp_get_max_threads();
+#endif
+          printfQuda("CPU: Batched matrix GEMM completed in %f seconds using %d threads with GFLOPS = %f\n", time,
+                     threads, 1e-9 * flops / time);
+        }
 
         return flops;
       }
@@ -2,6 +2,7 @@
 #include <cstdio>
 #include <string>
 #include <map>
+#include <mutex>
 #include <unistd.h>   // for getpagesize()
 #include <execinfo.h> // for backtrace
 #include <quda_internal.h>
@@ -596,6 +597,26 @@ namespace quda
         in the cache). */
     static std::map<void *, size_t> deviceSize;
 
+    /** Cache of inactive host-memory allocations, keyed by bin size.
+        We cache host memory allocations so that CPU-location fields
+        and temporaries can reuse these without paying page faults on
+        every allocation.*/
+    static std::multimap<size_t, void *> hostCache;
+
+    /** Bin sizes of active host-memory allocations. */
+    static std::map<void *, size_t> hostSize;
+
+    /** Total size of the cached host-memory allocations. */
+    static size_t hostCacheBytes = 0;
+
+    /** Cap on hostCacheBytes, beyond which freed host memory is
+        returned to the system (QUDA_HOST_MEMORY_POOL_LIMIT, in MiB) */
+    static size_t host_cache_limit = 1024ul * 1024 * 1024;
+
+    /** Unlike the device and pinned pools, the host pool may be used
+        from host threads, so its state is guarded by this mutex. */
+    static std::mutex host_pool_mutex;
+
     static bool pool_init = false;
 
     /** whether to use a memory pool allocator for device memory */
@@ -604,6 +625,9 @@ namespace quda
     /** whether to use a memory pool allocator for pinned memory */
     static bool pinned_memory_pool = true;
 
+    /** whether to use a memory pool allocator for host memory */
+    static bool host_memory_pool = true;
+
     void init()
     {
       if (!pool_init) {
@@ -626,6 +650,19 @@ namespace quda
           warningQuda("Not using pinned memory pool allocator");
           pinned_memory_pool = false;
         }
+
+        // host memory pool
+        char *enable_host_pool = getenv("QUDA_ENABLE_HOST_MEMORY_POOL");
+        if (!enable_host_pool || strcmp(enable_host_pool, "0") != 0) {
+          warningQuda("Using host memory pool allocator");
+          host_memory_pool = true;
+        } else {
+          warningQuda("Not using host memory pool allocator");
+          host_memory_pool = false;
+        }
+
+        char *host_pool_limit = getenv("QUDA_HOST_MEMORY_POOL_LIMIT");
+        if (host_pool_limit) host_cache_limit = std::stoul(host_pool_limit) * 1024 * 1024;
         pool_init = true;
       }
     }
@@ -670,6 +707,90 @@ namespace quda
       }
     }
 
+    /**
+       @brief Round a host allocation up to its bin: powers of two up
+       to 2 MiB (the huge-page size), and multiples of 2 MiB beyond.
+       @param nbytes Requested size
+       @return Bin size
+    */
+    static size_t host_bin_size(size_t nbytes)
+    {
+      constexpr size_t huge_page = 2 * 1024 * 1024;
+      if (nbytes >= huge_page) return ((nbytes + huge_page - 1) / huge_page) * huge_page;
+      size_t bin = 64;
+      while (bin < nbytes) bin *= 2;
+      return bin;
+    }
+
+    /**
+       @brief Touch every page of a fresh host allocation from the
+       OpenMP threads, using the same static schedule as the host
+       kernels, so that pages are placed on the NUMA domain of the
+       thread that will use them.  Allocations below 2 MiB span too
+       few pages to be worth starting a thread team for.
+       @param ptr Allocation
+       @param nbytes Size of allocation
+    */
+    static void host_first_touch(void *ptr, size_t nbytes)
+    {
+      if (nbytes < 2 * 1024 * 1024) return;
+      const size_t page = getpagesize();
+      const size_t n_page = (nbytes + page - 1) / page;
+      auto *p = static_cast<char *>(ptr);
+#pragma omp parallel for schedule(static)
+      for (size_t i = 0; i < n_page; i++) p[i * page] = 0;
+    }
+
+    void *host_malloc_(const char *func, const char *file, int line, size_t nbytes)
+    {
+      void *ptr = nullptr;
+      if (host_memory_pool) {
+        std::lock_guard<std::mutex> lock(host_pool_mutex);
+        nbytes = host_bin_size(nbytes);
+        auto it = hostCache.lower_bound(nbytes);
+        if (it != hostCache.end()) { // sufficiently large allocation found
+          nbytes = it->first;
+          ptr = it->second;
+          hostCacheBytes -= it->first;
+          hostCache.erase(it);
+        } else {
+          if (!hostCache.empty()) { // sacrifice the smallest cached allocation
+            it = hostCache.begin();
+            host_free(it->second);
+            hostCacheBytes -= it->first;
+            hostCache.erase(it);
+          }
+          ptr = quda::safe_malloc_(func, file, line, nbytes);
+          host_first_touch(ptr, nbytes);
+        }
+        hostSize[ptr] = nbytes;
+      } else {
+        ptr = quda::safe_malloc_(func, file, line, nbytes);
+      }
+      return ptr;
+    }
+
+    void host_free_(const char *func, const char *file, int line, void *ptr)
+    {
+      if (host_memory_pool) {
+        std::lock_guard<std::mutex> lock(host_pool_mutex);
+        if (!hostSize.count(ptr)) { errorQuda("Attempt to free invalid pointer"); }
+        hostCache.insert(std::make_pair(hostSize[ptr], ptr));
+        hostCacheBytes += hostSize[ptr];
+        hostSize.erase(ptr);
+
+        // trim the cache, releasing the largest allocations first
+        while (hostCacheBytes > host_cache_limit) {
+          auto it = std::prev(hostCache.end());
+          host_free(it->second);
+          hostCacheBytes -= it->first;
+          hostCache.erase(it);
+        }
+      } else {
+        quda::host_free_(func, file, line, ptr);
+      }
+    }
+
     void *device_malloc_(const char *func, const char *file, int line, size_t nbytes)
     {
       void *ptr = nullptr;
@@ -734,6 +855,16 @@ namespace quda
       }
     }
 
+    void flush_host()
+    {
+      if (host_memory_pool) {
+        std::lock_guard<std::mutex> lock(host_pool_mutex);
+        for (auto it : hostCache) { host_free(it.second); }
+        hostCache.clear();
+        hostCacheBytes = 0;
+      }
+    }
+
   } // namespace pool
 
 } // namespace quda
@@ -3,13 +3,20 @@
 #include <quda.h>     // for QUDA_VERSION_STRING
 #include <timer.h>
 #include <sys/stat.h> // for stat()
+#include <sys/mman.h> // for mmap()
 #include <fcntl.h>
 #include <cfloat> // for FLT_MAX
+#include <chrono>
+#include <cmath>
 #include <ctime>
 #include <fstream>
+#include <limits>
 #include <typeinfo>
-#include <map>
 #include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
 #include <unistd.h>
 #include <uint_to_char.h>
 #include <target_device.h>
@@ -21,6 +28,9 @@
 #include <json_helper.h>
 
 #include <communicator_quda.h>
+#ifdef QUDA_OPENMP
+#include <omp.h>
+#endif
 
 //#define LAUNCH_TIMER
 extern char *gitversion;
@@ -31,38 +41,70 @@ namespace quda
 
   TuneKey getLastTuneKey() { return quda::last_key; }
 
-  typedef std::map<TuneKey, TuneParam> map;
+  typedef tunecache_t map;
 
-  struct TraceKey {
+  /**
+     Compact record of a kernel launch or posted trace event.  Keys are
+     interned, so that records are fixed size and cheap to copy.
+   */
+  struct TraceRecord {
+    int64_t timestamp; /** Host time of the event in ns since the trace base (see traceEpoch) */
+    float time;        /** Tuned kernel time in s (zero for posted events) */
+    uint32_t key_id;   /** Interned key */
+    int64_t device_bytes;
+    int64_t pinned_bytes;
+    int64_t mapped_bytes;
+    int64_t host_bytes;
+  };
 
-    TuneKey key;
-    float time;
+  /**
+     Fixed capacity ring of trace records, one per thread.  Once full,
+     the ring is appended to the binary trace stream, or the oldest
+     records are overwritten if there is no stream.
+   */
+  struct TraceBuffer {
+    std::vector<TraceRecord> ring;
+    size_t size = 0; /** Number of valid records */
+    size_t head = 0; /** Next record to be written */
+    uint32_t thread = 0;
+    uint64_t dropped = 0;
+  };
 
-    long device_bytes;
-    long pinned_bytes;
-    long mapped_bytes;
-    long host_bytes;
+  /**
+     Binary trace stream format: the magic and the wall-clock base of
+     the timestamps, then a sequence of key and record chunks
+   */
+  static constexpr char trace_magic[8] = {'Q', 'U', 'D', 'A', 'T', 'R', 'C', '2'};
+  enum TraceChunk : uint32_t { TRACE_CHUNK_KEY = 0, TRACE_CHUNK_RECORDS = 1 };
 
-    TraceKey() {}
+  /**
+     Origin of the trace timestamps.  Records are timed with the steady
+     clock, and the wall clock at the same instant is written to the
+     stream header, so that the traces of different ranks can be
+     aligned.
+   */
+  struct TraceEpoch {
+    std::chrono::steady_clock::time_point steady;
+    int64_t wall; /** ns since the Unix epoch */
+  };
 
-    TraceKey(const TuneKey &key, float time) :
-      key(key),
-      time(time),
-      device_bytes(device_allocated_peak()),
-      pinned_bytes(pinned_allocated_peak()),
-      mapped_bytes(mapped_allocated_peak()),
-      host_bytes(host_allocated_peak())
-    {
-    }
+  static const TraceEpoch &traceEpoch()
+  {
+    static const TraceEpoch epoch
+      = {std::chrono::steady_clock::now(),
+         std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::system_clock::now().time_since_epoch())
+           .count()};
+    return epoch;
+  }
 
-    TraceKey(const TraceKey &) = default;
-    TraceKey(TraceKey &&) = default;
-    TraceKey &operator=(const TraceKey &) = default;
-    TraceKey &operator=(TraceKey &&) = default;
-  };
+  static std::mutex trace_mutex; // guards everything below
+  static std::vector<std::unique_ptr<TraceBuffer>> trace_buffers;
+  static std::unordered_map<TuneKey, uint32_t, TuneKey::Hash> trace_key_id;
+  static std::vector<TuneKey> trace_keys;
+  static std::ofstream trace_stream;
+  static std::string trace_stream_path;
+  static size_t trace_keys_streamed = 0;
 
-  // linked list that is augmented each time we call a kernel
-  static std::list<TraceKey> trace_list;
   static int enable_trace = 0;
 
   int traceEnabled()
@@ -85,6 +127,179 @@ namespace quda
     return enable_trace;
   }
 
+  /**
+     @return Number of trace records held per thread before they are
+     streamed to disk, set with QUDA_TRACE_BUFFER_SIZE (default 65536)
+   */
+  static size_t traceBufferSize()
+  {
+    static bool init = false;
+    static size_t size = 65536;
+
+    if (!init) {
+      char *size_str = getenv("QUDA_TRACE_BUFFER_SIZE");
+      if (size_str) {
+        long n = atol(size_str);
+        if (n <= 0) errorQuda("QUDA_TRACE_BUFFER_SIZE=%ld must be positive", n);
+        size = n;
+      }
+      init = true;
+    }
+    return size;
+  }
+
+  /**
+     @brief Open the binary trace stream of this rank on first use,
+     in the resource path.  Must be called with trace_mutex held.
+     @return Whether the stream is available
+   */
+  static bool openTraceStream()
+  {
+    if (trace_stream.is_open()) return true;
+    if (!trace_stream_path.empty()) return false; // already tried and failed
+
+    auto &resource_path = get_resource_path();
+    if (resource_path.empty()) {
+      trace_stream_path = "none";
+      warningQuda("Trace streaming disabled, only the last %lu events per thread will be kept", traceBufferSize());
+      return false;
+    }
+
+    char *profile_fname = getenv("QUDA_PROFILE_OUTPUT_BASE");
+    trace_stream_path = resource_path + "/" + (profile_fname ? std::string(profile_fname) + "_" : std::string())
+      + "trace_rank" + std::to_string(comm_rank_global()) + ".bin";
+    trace_stream.open(trace_stream_path.c_str(), std::ios::binary | std::ios::trunc);
+    if (!trace_stream) {
+      warningQuda("Unable to open trace stream %s", trace_stream_path.c_str());
+      return false;
+    }
+    trace_stream.write(trace_magic, sizeof(trace_magic));
+    trace_stream.write(reinterpret_cast<const char *>(&traceEpoch().wall), sizeof(traceEpoch().wall));
+    logQuda(QUDA_SUMMARIZE, "Streaming trace to %s\n", trace_stream_path.c_str());
+    return true;
+  }
+
+  /**
+     @brief Empty a trace buffer, appending its records (and any keys
+     not yet written) to the trace stream, or else dropping the oldest
+     record to make room.  Must be called with trace_mutex held.
+   */
+  static void flushTraceBuffer(TraceBuffer &buffer)
+  {
+    if (buffer.size == 0) return;
+
+    if (!openTraceStream()) {
+      if (buffer.size == buffer.ring.size()) {
+        buffer.size--;
+        buffer.dropped++;
+      }
+      return;
+    }
+
+    for (; trace_keys_streamed < trace_keys.size(); trace_keys_streamed++) {
+      uint32_t header[2] = {TRACE_CHUNK_KEY, static_cast<uint32_t>(trace_keys_streamed)};
+      auto &key = trace_keys[trace_keys_streamed];
+      trace_stream.write(reinterpret_cast<const char *>(header), sizeof(header));
+      trace_stream.write(key.volume, TuneKey::volume_n);
+      trace_stream.write(key.name, TuneKey::name_n);
+      trace_stream.write(key.aux, TuneKey::aux_n);
+    }
+
+    // write out oldest first, which may be in two pieces
+    const size_t capacity = buffer.ring.size();
+    const size_t tail = (buffer.head + capacity - buffer.size) % capacity;
+    uint32_t header[3] = {TRACE_CHUNK_RECORDS, buffer.thread, static_cast<uint32_t>(buffer.size)};
+    trace_stream.write(reinterpret_cast<const char *>(header), sizeof(header));
+    size_t first = std::min(buffer.size, capacity - tail);
+    trace_stream.write(reinterpret_cast<const char *>(&buffer.ring[tail]), first * sizeof(TraceRecord));
+    trace_stream.write(reinterpret_cast<const char *>(buffer.ring.data()), (buffer.size - first) * sizeof(TraceRecord));
+    trace_stream.flush();
+    buffer.size = 0;
+  }
+
+  /**
+     @brief Intern a trace key, so that records refer to it by id
+     @param[in] key Key to intern
+     @return Id of the key in the trace stream
+   */
+  static uint32_t internTraceKey(const TuneKey &key)
+  {
+    std::lock_guard<std::mutex> lock(trace_mutex);
+    auto id = trace_key_id.find(key);
+    if (id == trace_key_id.end()) {
+      id = trace_key_id.emplace(key, static_cast<uint32_t>(trace_keys.size())).first;
+      trace_keys.push_back(key);
+    }
+    return id->second;
+  }
+
+  /**
+     @brief Return the trace id of a tuned kernel, interning its key on
+     the first traced launch and caching the id alongside its tuned
+     parameters thereafter
+     @param[in] key Key of the kernel
+     @param[in,out] param Tunecache entry of the kernel
+     @return Id of the key in the trace stream
+   */
+  static uint32_t traceKeyId(const TuneKey &key, TuneParam &param)
+  {
+    if (param.trace_id < 0) param.trace_id = internTraceKey(key);
+    return param.trace_id;
+  }
+
+  /**
+     @brief Append an event to the calling thread's trace buffer.  The
+     buffer is only touched by its own thread, so trace_mutex is only
+     taken to register the buffer or to flush it once full.
+     @param[in] key_id Interned key of the event
+     @param[in] time Tuned time of the kernel (zero for posted events)
+   */
+  static void pushTrace(uint32_t key_id, float time)
+  {
+    const auto &epoch = traceEpoch();
+    thread_local TraceBuffer *buffer = nullptr;
+
+    if (!buffer) {
+      std::lock_guard<std::mutex> lock(trace_mutex);
+      trace_buffers.push_back(std::make_unique<TraceBuffer>());
+      buffer = trace_buffers.back().get();
+      buffer->ring.resize(traceBufferSize());
+      buffer->thread = trace_buffers.size() - 1;
+    }
+
+    if (buffer->size == buffer->ring.size()) {
+      std::lock_guard<std::mutex> lock(trace_mutex);
+      flushTraceBuffer(*buffer);
+    }
+
+    buffer->ring[buffer->head]
+      = {std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - epoch.steady).count(),
+         time,
+         key_id,
+         static_cast<int64_t>(device_allocated_peak()),
+         static_cast<int64_t>(pinned_allocated_peak()),
+         static_cast<int64_t>(mapped_allocated_peak()),
+         static_cast<int64_t>(host_allocated_peak())};
+    buffer->head = (buffer->head + 1) % buffer->ring.size();
+    buffer->size++;
+  }
+
+  /**
+     @brief Stream out the trace buffers of all threads.  This must not
+     race with launches from other threads.
+     @return Path to the binary trace stream, or empty if there is none
+   */
+  static std::string flushTrace()
+  {
+    std::lock_guard<std::mutex> lock(trace_mutex);
+    for (auto &buffer : trace_buffers) {
+      flushTraceBuffer(*buffer);
+      if (buffer->dropped > 0)
+        warningQuda("Trace buffer of thread %u dropped %lu events", buffer->thread, buffer->dropped);
+    }
+    return trace_stream.is_open() ? trace_stream_path : std::string();
+  }
+
   void postTrace_(const char *func, const char *file, int line)
   {
     if (traceEnabled() >= 1) {
@@ -95,8 +310,8 @@ namespace quda
       i32toa(tmp, line);
       strcat(aux, tmp);
       TuneKey key("", func, aux);
-      TraceKey trace_entry(key, 0.0);
-      trace_list.push_back(trace_entry);
+      // posted events are rare, so their keys are not cached per call site
+      pushTrace(internTraceKey(key), 0.0);
     }
   }
 
@@ -149,8 +364,161 @@ namespace quda
   void disableProfileCount() { profile_count = false; }
   void enableProfileCount() { profile_count = true; }
 
+  /**
+     Streaming quantile sketch of per-launch latencies.  Samples are
+     counted in logarithmic bins of relative width 2 * accuracy, so
+     any quantile is recovered to within that relative accuracy, with
+     memory that grows only with the dynamic range of the samples.
+   */
+  struct LatencySketch {
+    static constexpr double accuracy = 0.01;
+    std::map<int, uint64_t> bins;
+    uint64_t count = 0;
+    double sum = 0.0;
+    double max = 0.0;
+
+    static double gamma() { return (1.0 + accuracy) / (1.0 - accuracy); }
+
+    void add(double t)
+    {
+      // bin i holds samples in (gamma^(i-1), gamma^i]
+      bins[static_cast<int>(std::ceil(std::log(std::max(t, 1e-9)) / std::log(gamma())))]++;
+      count++;
+      sum += t;
+      max = std::max(max, t);
+    }
+
+    double mean() const { return count > 0 ? sum / count : 0.0; }
+
+    double quantile(double q) const
+    {
+      if (count == 0) return 0.0;
+      auto rank = static_cast<uint64_t>(q * (count - 1));
+      uint64_t seen = 0;
+      for (auto &bin : bins) {
+        seen += bin.second;
+        if (seen > rank) return std::min(2.0 * std::pow(gamma(), bin.first) / (gamma() + 1.0), max);
+      }
+      return max;
+    }
+  };
+
+  static std::unordered_map<TuneKey, LatencySketch, TuneKey::Hash> latency_profile;
+
+  /**
+     @return Whether to sample per-launch latencies for the profile,
+     set with QUDA_ENABLE_LATENCY_PROFILE=1.  Each sampled launch
+     records a pair of events on its stream, which adds some launch
+     overhead, so this is for diagnostic runs only.
+   */
+  static bool latencyProfileEnabled()
+  {
+    static bool init = false;
+    static bool enable = false;
+
+    if (!init) {
+      char *enable_str = getenv("QUDA_ENABLE_LATENCY_PROFILE");
+      if (enable_str && strcmp(enable_str, "1") == 0) {
+        enable = true;
+        warningQuda("QUDA_ENABLE_LATENCY_PROFILE=1: kernel launches will be timed with events");
+      }
+      init = true;
+    }
+    return enable;
+  }
+
+  /** A kernel launch bracketed by events on its stream, not yet added to the latency profile */
+  struct LatencySample {
+    TuneKey key;
+    qudaEvent_t start;
+    qudaEvent_t stop;
+  };
+
+  static std::mutex latency_mutex; // guards latency_profile and latency_samples
+  static std::deque<LatencySample> latency_samples;
+  static constexpr size_t max_latency_samples = 1024; /** Bound on the samples in flight */
+
+  /** Key of the kernel this thread is about to launch, if it is to be sampled */
+  static thread_local TuneKey latency_key;
+  static thread_local bool latency_pending = false;
+  static thread_local LatencySample latency_active;
+
+  /**
+     @brief Add completed samples to the latency profile, oldest first.
+     Must be called with latency_mutex held.
+     @param[in] n_wait Number of samples to wait for, even if they are
+     still running
+   */
+  static void harvestLatency(size_t n_wait)
+  {
+    while (!latency_samples.empty()) {
+      auto &sample = latency_samples.front();
+      if (n_wait > 0) {
+        qudaEventSynchronize(sample.stop);
+        n_wait--;
+      } else if (!qudaEventQuery(sample.stop)) {
+        break;
+      }
+      latency_profile[sample.key].add(qudaEventElapsedTime(sample.start, sample.stop));
+      qudaEventDestroy(sample.start);
+      qudaEventDestroy(sample.stop);
+      latency_samples.pop_front();
+    }
+  }
+
+  /**
+     @brief Add all outstanding samples to the latency profile
+   */
+  static void flushLatency()
+  {
+    std::lock_guard<std::mutex> lock(latency_mutex);
+    harvestLatency(latency_samples.size());
+  }
+
+  bool latencySampleStart(const qudaStream_t &stream)
+  {
+    if (!latency_pending) return false;
+    latency_pending = false; // only the first launch of a tuned tunable is sampled
+    latency_active.key = latency_key;
+    latency_active.start = qudaChronoEventCreate();
+    latency_active.stop = qudaChronoEventCreate();
+    qudaEventRecord(latency_active.start, stream);
+    return true;
+  }
+
+  void latencySampleStop(const qudaStream_t &stream)
+  {
+    qudaEventRecord(latency_active.stop, stream);
+    std::lock_guard<std::mutex> lock(latency_mutex);
+    latency_samples.push_back(latency_active);
+    harvestLatency(latency_samples.size() > max_latency_samples ? 1 : 0);
+  }
+
   const map &getTuneCache() { return tunecache; }
 
+  /**
+     @brief Return iterators to the tunecache entries sorted by key,
+     so that exported files do not depend on the hashed storage order.
+   */
+  static std::vector<map::const_iterator> sortedTuneCache()
+  {
+    std::vector<map::const_iterator> sorted;
+    sorted.reserve(tunecache.size());
+    for (auto entry = tunecache.cbegin(); entry != tunecache.cend(); entry++) sorted.push_back(entry);
+    std::sort(sorted.begin(), sorted.end(), [](const auto &a, const auto &b) { return a->first < b->first; });
+    return sorted;
+  }
+
+  /**
+   * Column headings of tunecache.tsv following the volume column.
+   * This is written as the description line and checked on load, so
+   * that a file written with a different column layout is never
+   * parsed positionally.
+   */
+  static const std::string tunecache_columns
+    = "\tname\taux\tblock.x\tblock.y\tblock.z\tgrid.x\tgrid.y\tgrid.z\tshared_bytes\taux.x\taux.y\taux.z\taux.w"
+      "\thost.threads\thost.chunk\thost.collapse\thost.schedule\ttime\tcomment";
+
   /**
    * Deserialize tunecache from an istream, useful for reading a file or receiving from other nodes.
    */
@@ -174,14 +542,21 @@ namespace quda
       ls.clear();
       ls.str(line);
       ls >> v >> n >> a >> param.block.x >> param.block.y >> param.block.z;
+      ls >> param.grid.x >> param.grid.y >> param.grid.z >> param.shared_bytes >> param.aux.x >> param.aux.y
+        >> param.aux.z >> param.aux.w;
+      ls >> param.host.threads >> param.host.chunk >> param.host.collapse >> param.host.schedule >> param.time;
+      // a malformed entry only costs a retune of that kernel, so drop it rather than abort
+      if (ls.fail() || v.length() >= key.volume_n || n.length() >= key.name_n || a.length() >= key.aux_n
+          || param.host.schedule < 0 || param.host.schedule > 2) {
+        warningQuda("Skipping bad tunecache entry \"%s\"", line.c_str());
+        continue;
+      }
       check = snprintf(key.volume, key.volume_n, "%s", v.c_str());
       if (check < 0 || check >= key.volume_n) errorQuda("Error writing volume string (check = %d)", check);
       check = snprintf(key.name, key.name_n, "%s", n.c_str());
       if (check < 0 || check >= key.name_n) errorQuda("Error writing name string (check=%d)", check);
       check = snprintf(key.aux, key.aux_n, "%s", a.c_str());
       if (check < 0 || check >= key.aux_n) errorQuda("Error writing aux string (check=%d)", check);
-      ls >> param.grid.x >> param.grid.y >> param.grid.z >> param.shared_bytes >> param.aux.x >> param.aux.y
-        >> param.aux.z >> param.aux.w >> param.time;
       ls.ignore(1);               // throw away tab before comment
       getline(ls, param.comment); // assume anything remaining on the line is a comment
       param.comment += "\n";      // our convention is to include the newline, since ctime() likes to do this
@@ -194,21 +569,264 @@ namespace quda
    */
   static void serializeTuneCache(std::ostream &out)
   {
-    map::iterator entry;
-
-    for (entry = tunecache.begin(); entry != tunecache.end(); entry++) {
-      TuneKey key = entry->first;
-      TuneParam param = entry->second;
+    for (auto &entry : sortedTuneCache()) {
+      const TuneKey &key = entry->first;
+      const TuneParam &param = entry->second;
 
       out << std::setw(16) << key.volume << "\t" << key.name << "\t" << key.aux << "\t";
       out << param.block.x << "\t" << param.block.y << "\t" << param.block.z << "\t";
       out << param.grid.x << "\t" << param.grid.y << "\t" << param.grid.z << "\t";
       out << param.shared_bytes << "\t" << param.aux.x << "\t" << param.aux.y << "\t" << param.aux.z << "\t"
           << param.aux.w << "\t";
+      out << param.host.threads << "\t" << param.host.chunk << "\t" << param.host.collapse << "\t"
+          << param.host.schedule << "\t";
       out << param.time << "\t" << param.comment; // param.comment ends with a newline
     }
   }
 
+  /**
+     Binary tunecache format.  This is a compact, build-specific image
+     of the tunecache used for fast startup and for broadcasting the
+     cache between ranks; the text tunecache.tsv remains the portable
+     export/import format.  The layout is
+
+       magic | id strings (version, git version, hash) | n_entries |
+       n_entries x (TuneRecord | volume | name | aux | comment)
+
+     where every string is stored without a null terminator.
+   */
+  static constexpr char tunecache_binary_magic[8] = {'Q', 'U', 'D', 'A', 'T', 'C', 'B', '2'};
+
+  struct TuneRecord {
+    uint32_t block[3];
+    uint32_t grid[3];
+    uint32_t shared_bytes;
+    uint32_t set_max_shared_bytes;
+    int32_t aux[4];
+    int32_t host[4];
+    float time;
+    uint32_t volume_len;
+    uint32_t name_len;
+    uint32_t aux_len;
+    uint32_t comment_len;
+  };
+
+  /**
+     @brief Whether the binary tunecache (tunecache.bin) is read and
+     written in addition to the text tunecache.  Enabled by setting
+     QUDA_ENABLE_TUNECACHE_BINARY=1.
+   */
+  static bool tunecacheBinaryEnabled()
+  {
+    static bool enable = false;
+    static bool init = false;
+
+    if (!init) {
+      char *enable_binary_env = getenv("QUDA_ENABLE_TUNECACHE_BINARY");
+      if (enable_binary_env && strcmp(enable_binary_env, "1") == 0) enable = true;
+      init = true;
+    }
+    return enable;
+  }
+
+  static std::vector<std::string> tunecacheBinaryId()
+  {
+#ifdef GITVERSION
+    return {quda_version, gitversion, quda_hash};
+#else
+    return {quda_version, quda_version, quda_hash};
+#endif
+  }
+
+  /**
+   * Serialize tunecache into a binary buffer.
+   */
+  static void serializeTuneCacheBinary(std::vector<char> &buffer)
+  {
+    auto append = [&buffer](const void *data, size_t bytes) {
+      auto ptr = static_cast<const char *>(data);
+      buffer.insert(buffer.end(), ptr, ptr + bytes);
+    };
+
+    buffer.clear();
+    append(tunecache_binary_magic, sizeof(tunecache_binary_magic));
+    for (auto &id : tunecacheBinaryId()) {
+      uint32_t length = id.length();
+      append(&length, sizeof(length));
+      append(id.data(), length);
+    }
+
+    uint64_t n_entries = tunecache.size();
+    append(&n_entries, sizeof(n_entries));
+
+    for (auto &entry : tunecache) {
+      const TuneKey &key = entry.first;
+      const TuneParam &param = entry.second;
+      TuneRecord record = {{param.block.x, param.block.y, param.block.z},
+                           {param.grid.x, param.grid.y, param.grid.z},
+                           param.shared_bytes,
+                           param.set_max_shared_bytes,
+                           {param.aux.x, param.aux.y, param.aux.z, param.aux.w},
+                           {param.host.threads, param.host.chunk, param.host.collapse, param.host.schedule},
+                           param.time,
+                           static_cast<uint32_t>(strlen(key.volume)),
+                           static_cast<uint32_t>(strlen(key.name)),
+                           static_cast<uint32_t>(strlen(key.aux)),
+                           static_cast<uint32_t>(param.comment.length())};
+      append(&record, sizeof(record));
+      append(key.volume, record.volume_len);
+      append(key.name, record.name_len);
+      append(key.aux, record.aux_len);
+      append(param.comment.data(), record.comment_len);
+    }
+  }
+
+  /**
+   * Deserialize tunecache from a binary buffer, e.g., a memory-mapped
+   * tunecache.bin or a buffer received from another rank.  Returns
+   * false (without modifying the tunecache) if the buffer is not a
+   * valid binary tunecache, e.g., it is corrupt or of an older format,
+   * or if the identification header does not match this build and
+   * version checking is enabled.  The caller should then fall back to
+   * the text tunecache.
+   */
+  static bool deserializeTuneCacheBinary(const char *buffer, size_t size, const std::string &source,
+                                         bool version_check = true)
+  {
+    size_t offset = 0;
+    auto read = [&](void *data, size_t bytes) {
+      if (offset + bytes > size) return false;
+      memcpy(data, buffer + offset, bytes);
+      offset += bytes;
+      return true;
+    };
+    auto read_string = [&](char *str, size_t length, size_t max_length) {
+      if (length >= max_length || !read(str, length)) return false;
+      str[length] = '\0';
+      return true;
+    };
+    auto bad_format = [&]() {
+      warningQuda("Bad format in %s, ignoring", source.c_str());
+      return false;
+    };
+
+    char magic[sizeof(tunecache_binary_magic)];
+    if (!read(magic, sizeof(magic)) || memcmp(magic, tunecache_binary_magic, sizeof(magic))) return bad_format();
+
+    for (auto &id : tunecacheBinaryId()) {
+      uint32_t length;
+      if (!read(&length, sizeof(length)) || offset + length > size) return bad_format();
+      if (version_check && id.compare(0, std::string::npos, buffer + offset, length)) {
+        warningQuda("Binary cache %s does not match current QUDA build, ignoring", source.c_str());
+        return false;
+      }
+      offset += length;
+    }
+
+    uint64_t n_entries;
+    if (!read(&n_entries, sizeof(n_entries)) || n_entries > size) return bad_format();
+
+    // decode everything before touching the tunecache, so a truncated buffer leaves it unchanged
+    std::vector<std::pair<TuneKey, TuneParam>> entries(n_entries);
+    for (auto &entry : entries) {
+      TuneKey &key = entry.first;
+      TuneParam &param = entry.second;
+      TuneRecord record;
+      if (!read(&record, sizeof(record)) || !read_string(key.volume, record.volume_len, key.volume_n)
+          || !read_string(key.name, record.name_len, key.name_n) || !read_string(key.aux, record.aux_len, key.aux_n)
+          || offset + record.comment_len > size)
+        return bad_format();
+
+      param.block = dim3(record.block[0], record.block[1], record.block[2]);
+      param.grid = dim3(record.grid[0], record.grid[1], record.grid[2]);
+      param.shared_bytes = record.shared_bytes;
+      param.set_max_shared_bytes = record.set_max_shared_bytes;
+      param.aux = make_int4(record.aux[0], record.aux[1], record.aux[2], record.aux[3]);
+      param.host = {record.host[0], record.host[1], record.host[2], record.host[3]};
+      param.time = record.time;
+      param.comment.assign(buffer + offset, record.comment_len);
+      offset += record.comment_len;
+    }
+
+    tunecache.reserve(tunecache.size() + n_entries);
+    for (auto &entry : entries) {
+      TuneParam &param = tunecache[entry.first]; // retains n_calls if already present
+      TuneParam &record = entry.second;
+      param.block = record.block;
+      param.grid = record.grid;
+      param.shared_bytes = record.shared_bytes;
+      param.set_max_shared_bytes = record.set_max_shared_bytes;
+      param.aux = record.aux;
+      param.host = record.host;
+      param.time = record.time;
+      param.comment = std::move(record.comment);
+    }
+
+    return true;
+  }
+
+  /**
+   * Read the binary tunecache by memory mapping it.  Returns false if
+   * the file is absent, corrupt, or was written by a different build.
+   */
+  static bool loadTuneCacheBinary(const std::string &path, bool version_check)
+  {
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd == -1) return false;
+
+    struct stat fstat_buf;
+    if (fstat(fd, &fstat_buf) || fstat_buf.st_size == 0) {
+      close(fd);
+      return false;
+    }
+    size_t size = fstat_buf.st_size;
+
+    void *buffer = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (buffer == MAP_FAILED) {
+      warningQuda("Unable to memory map %s", path.c_str());
+      return false;
+    }
+
+    bool loaded = deserializeTuneCacheBinary(static_cast<const char *>(buffer), size, path, version_check);
+    munmap(buffer, size);
+    return loaded;
+  }
+
+  /**
+   * Write the binary tunecache.  We write to a temporary file and then
+   * rename, so that a concurrent reader never maps a partial file.
+   */
+  static void saveTuneCacheBinary(const std::string &path)
+  {
+    std::vector<char> buffer;
+    serializeTuneCacheBinary(buffer);
+
+    std::string tmp_path = path + ".tmp";
+    std::ofstream cache_file(tmp_path.c_str(), std::ios::binary);
+    cache_file.write(buffer.data(), buffer.size());
+    cache_file.close();
+    if (!cache_file || rename(tmp_path.c_str(), path.c_str())) {
+      warningQuda("Unable to write binary cache file %s", path.c_str());
+      remove(tmp_path.c_str());
+      remove(path.c_str()); // don't leave a stale copy behind
+    }
+  }
+
+  /**
+   * The binary tunecache is only a faster-loading copy of the text
+   * tunecache, so it is stale if the text tunecache has been written
+   * since, e.g., by a run with the binary tunecache disabled or by
+   * hand.  Returns true if the binary is at least as new as the text.
+   */
+  static bool tuneCacheBinaryIsCurrent(const std::string &binary_path, const std::string &text_path)
+  {
+    struct stat binary_stat, text_stat;
+    if (stat(binary_path.c_str(), &binary_stat)) return false;
+    if (stat(text_path.c_str(), &text_stat)) return true;
+    return binary_stat.st_mtime >= text_stat.st_mtime;
+  }
+
   template <class T> struct less_significant {
     inline bool operator()(const T &lhs, const T &rhs)
     {
@@ -294,30 +912,165 @@ namespace quda
   }
 
   /**
-   * Serialize trace to an ostream, useful for writing to a file or sending to other nodes.
+   * Serialize the synchronous profile as json, with the throughput of
+   * each kernel at its tuned time and, if sampled, its measured
+   * latency percentiles and throughput.
    */
-  static void serializeTrace(std::ostream &out)
+  static void serializeProfileJson(std::ostream &out, const std::string &label, const std::string &date)
   {
-    for (auto it = trace_list.begin(); it != trace_list.end(); it++) {
+    json kernels = json::array();
+    double total_time = 0.0;
 
-      TuneKey &key = it->key;
+    for (auto &entry : sortedTuneCache()) {
+      const TuneKey &key = entry->first;
+      const TuneParam &param = entry->second;
 
-      // special case kernel members of a policy
       char tmp[TuneKey::aux_n] = {};
       strncpy(tmp, key.aux, TuneKey::aux_n);
-      bool is_policy_kernel = strcmp(tmp, "policy_kernel") == 0 ? true : false;
-
-      out << std::setw(12) << it->time << "\t";
-      out << std::setw(12) << it->device_bytes << "\t";
-      out << std::setw(12) << it->pinned_bytes << "\t";
-      out << std::setw(12) << it->mapped_bytes << "\t";
-      out << std::setw(12) << it->host_bytes << "\t";
-      out << std::setw(16) << key.volume << "\t";
-      if (is_policy_kernel) out << "\t";
-      out << key.name << "\t";
-      if (!is_policy_kernel) out << "\t";
-      out << key.aux << std::endl;
+      bool is_policy_kernel = strncmp(tmp, "policy_kernel", 13) == 0 ? true : false;
+      bool is_policy = (strncmp(tmp, "policy", 6) == 0 && !is_policy_kernel) ? true : false;
+      bool is_nested_policy = (strncmp(tmp, "nested_policy", 6) == 0) ? true : false;
+      if (param.n_calls == 0 || is_policy || is_nested_policy) continue;
+
+      double time = param.n_calls * param.time;
+      total_time += time;
+
+      json k = {{"name", key.name},
+                {"volume", key.volume},
+                {"aux", key.aux},
+                {"calls", param.n_calls},
+                {"time_per_call", param.time},
+                {"total_time", time},
+                {"flops_per_call", param.flops},
+                {"bytes_per_call", param.bytes},
+                {"tuned_gflops", param.time > 0 ? 1e-9 * param.flops / param.time : 0.0},
+                {"tuned_gbytes_per_sec", param.time > 0 ? 1e-9 * param.bytes / param.time : 0.0}};
+
+      // rates from the measured launches, rather than the time recorded when tuning
+      auto sketch = latency_profile.find(key);
+      if (sketch != latency_profile.end()) {
+        auto &l = sketch->second;
+        k["latency"] = {{"samples", l.count},
+                        {"mean", l.mean()},
+                        {"p50", l.quantile(0.5)},
+                        {"p90", l.quantile(0.9)},
+                        {"p99", l.quantile(0.99)},
+                        {"max", l.max},
+                        {"gflops", l.mean() > 0 ? 1e-9 * param.flops / l.mean() : 0.0},
+                        {"gbytes_per_sec", l.mean() > 0 ? 1e-9 * param.bytes / l.mean() : 0.0}};
+      }
+      kernels.push_back(k);
+    }
+
+    json j = {{"label", label},   {"version", quda_version}, {"hash", quda_hash},
+              {"date", date},     {"ranks", comm_size()},   {"total_time", total_time},
+              {"kernels", kernels}};
+    out << j.dump(2) << std::endl;
+  }
+
+  /**
+     @brief Open a binary trace stream and read its header
+     @param[in,out] in Stream to open
+     @param[in] trace_path Path of the trace stream
+     @return Wall-clock base of the timestamps in ns since the Unix epoch
+   */
+  static int64_t openTraceStreamIn(std::ifstream &in, const std::string &trace_path)
+  {
+    in.open(trace_path.c_str(), std::ios::binary);
+    char magic[sizeof(trace_magic)] = {};
+    in.read(magic, sizeof(magic));
+    if (!in || memcmp(magic, trace_magic, sizeof(magic)) != 0)
+      errorQuda("%s is not a trace stream", trace_path.c_str());
+    int64_t base = 0;
+    in.read(reinterpret_cast<char *>(&base), sizeof(base));
+    if (!in) errorQuda("Truncated trace stream %s", trace_path.c_str());
+    return base;
+  }
+
+  int64_t traceStreamBase(const std::string &trace_path)
+  {
+    std::ifstream in;
+    return openTraceStreamIn(in, trace_path);
+  }
+
+  void convertTraceToChrome(const std::string &trace_path, const std::string &json_path, int pid, int64_t origin)
+  {
+    std::ifstream in;
+    const int64_t offset = openTraceStreamIn(in, trace_path) - origin;
+
+    std::ofstream out(json_path.c_str());
+    if (!out) errorQuda("Unable to open %s", json_path.c_str());
+
+    // events are written out one record chunk at a time, so memory use is bounded by the chunk size
+    out << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+    bool first_event = true;
+
+    std::vector<TuneKey> keys;
+    std::vector<TraceRecord> records;
+    uint32_t type;
+    while (in.read(reinterpret_cast<char *>(&type), sizeof(type))) {
+      if (type == TRACE_CHUNK_KEY) {
+        uint32_t id;
+        in.read(reinterpret_cast<char *>(&id), sizeof(id));
+        if (id >= keys.size()) keys.resize(id + 1);
+        in.read(keys[id].volume, TuneKey::volume_n);
+        in.read(keys[id].name, TuneKey::name_n);
+        in.read(keys[id].aux, TuneKey::aux_n);
+      } else if (type == TRACE_CHUNK_RECORDS) {
+        uint32_t header[2]; // thread, count
+        in.read(reinterpret_cast<char *>(header), sizeof(header));
+        records.resize(header[1]);
+        in.read(reinterpret_cast<char *>(records.data()), records.size() * sizeof(TraceRecord));
+        for (auto &r : records) {
+          if (r.key_id >= keys.size()) errorQuda("Trace record references unknown key %u", r.key_id);
+          auto &key = keys[r.key_id];
+          // kernels are complete events of their tuned duration, posted events are instants
+          json e = {{"name", key.name},
+                    {"cat", r.time > 0 ? "kernel" : "post"},
+                    {"ph", r.time > 0 ? "X" : "i"},
+                    {"ts", 1e-3 * (offset + r.timestamp)},
+                    {"pid", pid},
+                    {"tid", header[0]},
+                    {"args",
+                     {{"volume", key.volume},
+                      {"aux", key.aux},
+                      {"device_mem", r.device_bytes},
+                      {"pinned_mem", r.pinned_bytes},
+                      {"mapped_mem", r.mapped_bytes},
+                      {"host_mem", r.host_bytes}}}};
+          if (r.time > 0)
+            e["dur"] = 1e6 * r.time;
+          else
+            e["s"] = "t";
+          out << (first_event ? "\n" : ",\n") << e.dump();
+          first_event = false;
+        }
+      } else {
+        errorQuda("Bad chunk type %u in %s", type, trace_path.c_str());
+      }
+      if (!in) errorQuda("Truncated trace stream %s", trace_path.c_str());
     }
+
+    out << "\n]}" << std::endl;
+    if (!out) errorQuda("Error writing %s", json_path.c_str());
+  }
+
+  void saveTrace()
+  {
+    if (!traceEnabled()) return;
+
+    // every rank converts its own stream, next to it
+    std::string trace_stream_file = flushTrace();
+
+    // align the ranks on the earliest whole second of their wall-clock bases, which is exact as a double
+    std::vector<double> origin = {trace_stream_file.empty() ? std::numeric_limits<double>::max() :
+                                                              std::floor(1e-9 * traceStreamBase(trace_stream_file))};
+    comm_allreduce_min(origin);
+
+    if (trace_stream_file.empty()) return;
+    std::string trace_path = trace_stream_file.substr(0, trace_stream_file.rfind(".bin")) + ".json";
+    logQuda(QUDA_SUMMARIZE, "Saving trace of %s to %s\n", trace_stream_file.c_str(), trace_path.c_str());
+    convertTraceToChrome(trace_stream_file, trace_path, comm_rank_global(), static_cast<int64_t>(origin[0]) * 1000000000);
   }
 
   /**
@@ -326,25 +1079,19 @@ namespace quda
    */
   static void broadcastTuneCache(int32_t root_rank = 0)
   {
-    std::stringstream serialized;
+    std::vector<char> serialized;
     size_t size;
 
     if (comm_rank_global() == root_rank) {
-      serializeTuneCache(serialized);
-      size = serialized.str().length();
+      serializeTuneCacheBinary(serialized);
+      size = serialized.size();
     }
     comm_broadcast_global(&size, sizeof(size_t), root_rank);
 
     if (size > 0) {
-      if (comm_rank_global() == root_rank) {
-        comm_broadcast_global(const_cast<char *>(serialized.str().c_str()), size, root_rank);
-      } else {
-        std::vector<char> serstr(size + 1);
-        comm_broadcast_global(serstr.data(), size, root_rank);
-        serstr[size] = '\0'; // null-terminate
-        serialized.str(serstr.data());
-        deserializeTuneCache(serialized);
-      }
+      if (comm_rank_global() != root_rank) serialized.resize(size);
+      comm_broadcast_global(serialized.data(), size, root_rank);
+      if (comm_rank_global() != root_rank) deserializeTuneCacheBinary(serialized.data(), size, "tunecache broadcast");
     }
   }
 
@@ -370,11 +1117,24 @@ namespace quda
     }
 
     if (comm_rank_global() == 0) {
+      std::string binary_path = get_resource_path() + "/tunecache.bin";
       cache_path = get_resource_path();
       cache_path += "/tunecache.tsv";
-      cache_file.open(cache_path.c_str());
 
-      if (cache_file) {
+      bool binary_loaded = false;
+      if (tunecacheBinaryEnabled()) {
+        if (tuneCacheBinaryIsCurrent(binary_path, cache_path))
+          binary_loaded = loadTuneCacheBinary(binary_path, version_check);
+        else if (access(binary_path.c_str(), F_OK) == 0)
+          logQuda(QUDA_SUMMARIZE, "Ignoring %s since %s is newer\n", binary_path.c_str(), cache_path.c_str());
+      }
+      if (!binary_loaded) cache_file.open(cache_path.c_str());
+
+      if (binary_loaded) {
+        initial_cache_size = tunecache.size();
+        logQuda(QUDA_SUMMARIZE, "Loaded %d sets of cached parameters from %s\n", static_cast<int>(initial_cache_size),
+                binary_path.c_str());
+      } else if (cache_file) {
 
         if (!cache_file.good()) errorQuda("Bad format in %s", cache_path.c_str());
         getline(cache_file, line);
@@ -408,15 +1168,21 @@ namespace quda
         getline(cache_file, line); // eat the blank line
 
         if (!cache_file.good()) errorQuda("Bad format in %s", cache_path.c_str());
-        getline(cache_file, line); // eat the description line
-
-        deserializeTuneCache(cache_file);
+        getline(cache_file, line); // the description line gives the column layout
+        line.erase(0, line.find_first_not_of(' '));
+
+        if (line == "volume" + tunecache_columns) {
+          deserializeTuneCache(cache_file);
+          initial_cache_size = tunecache.size();
+          logQuda(QUDA_SUMMARIZE, "Loaded %d sets of cached parameters from %s\n",
+                  static_cast<int>(initial_cache_size), cache_path.c_str());
+        } else {
+          warningQuda("Cache file %s has an outdated column layout and will be ignored.  All kernels will be "
+                      "re-tuned (if tuning is enabled).",
+                      cache_path.c_str());
+        }
 
         cache_file.close();
-        initial_cache_size = tunecache.size();
-
-        logQuda(QUDA_SUMMARIZE, "Loaded %d sets of cached parameters from %s\n", static_cast<int>(initial_cache_size),
-                cache_path.c_str());
 
       } else {
         warningQuda("Cache file not found.  All kernels will be re-tuned (if tuning is enabled).");
@@ -484,13 +1250,19 @@ namespace quda
       cache_file << "\t" << quda_version;
 #endif
       cache_file << "\t" << quda_hash << "\t# Last updated " << ctime(&now) << std::endl;
-      cache_file << std::setw(16) << "volume"
-                 << "\tname\taux\tblock.x\tblock.y\tblock.z\tgrid.x\tgrid.y\tgrid.z\tshared_bytes\taux.x\taux.y\taux."
-                    "z\taux.w\ttime\tcomment"
-                 << std::endl;
+      cache_file << std::setw(16) << "volume" << tunecache_columns << std::endl;
       serializeTuneCache(cache_file);
       cache_file.close();
 
+      // keep the binary tunecache in step with the text tunecache, or
+      // remove it so that a stale copy is never loaded in its place
+      if (!error) {
+        if (tunecacheBinaryEnabled())
+          saveTuneCacheBinary(resource_path + "/tunecache.bin");
+        else
+          remove((resource_path + "/tunecache.bin").c_str());
+      }
+
       // Release lock.
       close(lock_handle);
       remove(lock_path.c_str());
@@ -517,11 +1289,13 @@ namespace quda
   // flush profile, setting counts to zero
   void flushProfile()
   {
-    for (map::iterator entry = tunecache.begin(); entry != tunecache.end(); entry++) {
+    for (auto entry = tunecache.begin(); entry != tunecache.end(); entry++) {
       // set all n_calls = 0
       TuneParam &param = entry->second;
       param.n_calls = 0;
     }
+    if (latencyProfileEnabled()) flushLatency();
+    latency_profile.clear();
   }
 
   // save profile
@@ -529,8 +1303,8 @@ namespace quda
   {
     time_t now;
     int lock_handle;
-    std::string lock_path, profile_path, async_profile_path, trace_path;
-    std::ofstream profile_file, async_profile_file, trace_file;
+    std::string lock_path, profile_path, async_profile_path, json_profile_path;
+    std::ofstream profile_file, async_profile_file, json_profile_file;
     auto &resource_path = get_resource_path();
 
     if (resource_path.empty()) {
@@ -538,6 +1312,9 @@ namespace quda
       return;
     }
 
+    // every rank streams out its own trace, which is converted once by saveTrace
+    if (traceEnabled()) flushTrace();
+
     if (comm_rank_global() == 0) { // Make sure only one rank is writing to disk
 
       // Acquire lock.  Note that this is only robust if the filesystem supports flock() semantics, which is true for
@@ -566,25 +1343,24 @@ namespace quda
           "Environment variable QUDA_PROFILE_OUTPUT_BASE not set; writing to profile.tsv and profile_async.tsv");
         profile_path = resource_path + "/profile_" + std::to_string(count) + ".tsv";
         async_profile_path = resource_path + "/profile_async_" + std::to_string(count) + ".tsv";
-        if (traceEnabled()) trace_path = resource_path + "/trace_" + std::to_string(count) + ".tsv";
+        json_profile_path = resource_path + "/profile_" + std::to_string(count) + ".json";
       } else {
         profile_path = resource_path + "/" + profile_fname + "_" + std::to_string(count) + ".tsv";
         async_profile_path = resource_path + "/" + profile_fname + "_" + std::to_string(count) + "_async.tsv";
-        if (traceEnabled())
-          trace_path = resource_path + "/" + profile_fname + "_trace_" + std::to_string(count) + ".tsv";
+        json_profile_path = resource_path + "/" + profile_fname + "_" + std::to_string(count) + ".json";
       }
 
       count++;
 
       profile_file.open(profile_path.c_str());
       async_profile_file.open(async_profile_path.c_str());
-      if (traceEnabled()) trace_file.open(trace_path.c_str());
+      json_profile_file.open(json_profile_path.c_str());
 
       if (getVerbosity() >= QUDA_SUMMARIZE) {
         // compute number of non-zero entries that will be output in the profile
         int n_entry = 0;
         int n_policy = 0;
-        for (map::iterator entry = tunecache.begin(); entry != tunecache.end(); entry++) {
+        for (auto entry = tunecache.begin(); entry != tunecache.end(); entry++) {
           // if a policy entry, then we can ignore
           char tmp[TuneKey::aux_n] = {};
           strncpy(tmp, entry->first.aux, TuneKey::aux_n);
@@ -596,8 +1372,7 @@ namespace quda
 
         printfQuda("Saving %d sets of cached parameters to %s\n", n_entry, profile_path.c_str());
         printfQuda("Saving %d sets of cached profiles to %s\n", n_policy, async_profile_path.c_str());
-        if (traceEnabled())
-          printfQuda("Saving trace list with %lu entries to %s\n", trace_list.size(), trace_path.c_str());
+        printfQuda("Saving kernel throughput profile to %s\n", json_profile_path.c_str());
       }
 
       time(&now);
@@ -636,28 +1411,15 @@ namespace quda
 
       serializeProfile(profile_file, async_profile_file);
 
+      // include the samples of launches still in flight
+      if (latencyProfileEnabled()) flushLatency();
+      std::string date = ctime(&now);
+      date.pop_back(); // strip the newline
+      serializeProfileJson(json_profile_file, Label, date);
+
       profile_file.close();
       async_profile_file.close();
-
-      if (traceEnabled()) {
-        trace_file << "trace"
-                   << "\t" << quda_version;
-#ifdef GITVERSION
-        trace_file << "\t" << gitversion;
-#else
-        trace_file << "\t" << quda_version;
-#endif
-        trace_file << "\t" << quda_hash << "\t# Last updated " << ctime(&now) << std::endl;
-
-        trace_file << std::setw(12) << "time\t" << std::setw(12) << "device-mem\t" << std::setw(12) << "pinned-mem\t";
-        trace_file << std::setw(12) << "mapped-mem\t" << std::setw(12) << "host-mem\t";
-        trace_file << std::setw(16) << "volume"
-                   << "\tname\taux" << std::endl;
-
-        serializeTrace(trace_file);
-
-        trace_file.close();
-      }
+      json_profile_file.close();
 
       // Release lock.
       close(lock_handle);
@@ -676,6 +1438,46 @@ namespace quda
     return output;
   }
 
+  std::ostream &operator<<(std::ostream &output, const HostLaunchParam &param)
+  {
+    constexpr const char *schedule[] = {"static", "dynamic", "guided"};
+    output << "host=(threads=" << param.threads << ", schedule=" << schedule[param.schedule];
+    output << ", chunk=" << param.chunk << ", collapse=" << param.collapse << ")";
+    return output;
+  }
+
+  bool advanceHostLaunchParam(HostLaunchParam &param, int loop_depth)
+  {
+    constexpr int max_chunk = 16;
+    if (param.chunk < max_chunk) {
+      param.chunk = param.chunk == 0 ? 1 : max_chunk;
+      return true;
+    }
+    param.chunk = 0;
+
+    if (param.schedule < 2) {
+      param.schedule++;
+      return true;
+    }
+    param.schedule = 0;
+
+    if (param.collapse < loop_depth) {
+      param.collapse++;
+      return true;
+    }
+    param.collapse = 1;
+
+#ifdef QUDA_OPENMP
+    int threads = param.threads > 0 ? param.threads : omp_get_max_threads();
+    if (threads > 1) {
+      param.threads = threads / 2;
+      return true;
+    }
+#endif
+    param.threads = 0;
+    return false;
+  }
+
   bool Tunable::tuneSharedBytes() const
   {
     static bool tune_shared = true;
@@ -758,8 +1560,10 @@ namespace quda
    *
    */
 
-  NLOHMANN_DEFINE_TYPE_NON_INTRUSIVE(TuneParam, block, grid, shared_bytes, set_max_shared_bytes, aux, comment, time,
-                                     n_calls)
+  NLOHMANN_DEFINE_TYPE_NON_INTRUSIVE(HostLaunchParam, threads, chunk, collapse, schedule)
+
+  NLOHMANN_DEFINE_TYPE_NON_INTRUSIVE(TuneParam, block, grid, shared_bytes, set_max_shared_bytes, aux, host, comment,
+                                     time, n_calls)
 
   class TuneCandidates : public std::priority_queue<TuneParam, std::vector<TuneParam>, TuneParamComp>
   {
@@ -867,6 +1671,7 @@ namespace quda
 #endif
 
     TuneKey key = tunable.tuneKey();
+    latency_pending = false; // set below if this launch is to be sampled
     if (use_managed_memory()) strcat(key.aux, ",managed");
     last_key = key;
     bool is_policy = strncmp(key.aux, "policy,", 7) == 0 ? true : false;
@@ -907,14 +1712,17 @@ namespace quda
       launchTimer.TPSTOP(QUDA_PROFILE_TOTAL);
 #endif
 
-      if (traceEnabled() >= 2) {
-        TraceKey trace_entry(key, param_tuned.time);
-        trace_list.push_back(trace_entry);
-      }
+      if (traceEnabled() >= 2) pushTrace(traceKeyId(key, param_tuned), param_tuned.time);
 
       if (!is_policy) {
-        Tunable::flops_global(Tunable::flops_global() + tunable.flops()); // increment flops counter
-        Tunable::bytes_global(Tunable::bytes_global() + tunable.bytes()); // increment bytes counter
+        param_tuned.flops = tunable.flops();
+        param_tuned.bytes = tunable.bytes();
+        Tunable::flops_global(Tunable::flops_global() + param_tuned.flops); // increment flops counter
+        Tunable::bytes_global(Tunable::bytes_global() + param_tuned.bytes); // increment bytes counter
+        if (!tuning && profile_count && latencyProfileEnabled()) {
+          latency_key = key;
+          latency_pending = true;
+        }
       }
       return param_tuned;
     }
@@ -981,6 +1789,7 @@ namespace quda
         tune_timer.start(__func__, __FILE__, __LINE__);
 
         param.aux = make_int4(-1, -1, -1, -1);
+        param.host = HostLaunchParam();
         tunable.initTuneParam(param);
 
         auto error = QUDA_SUCCESS;
@@ -1138,12 +1947,10 @@ namespace quda
 
         errorQuda("Failed to find key entry (%s:%s:%s)", key.name, key.volume, key.aux);
       }
-      param = tunecache[key]; // read this now for all processes
+      TuneParam &param_tuned = tunecache[key];
+      param = param_tuned; // read this now for all processes
 
-      if (traceEnabled() >= 2) {
-        TraceKey trace_entry(key, param.time);
-        trace_list.push_back(trace_entry);
-      }
+      if (traceEnabled() >= 2) pushTrace(traceKeyId(key, param_tuned), param.time);
 
     } else if (&tunable != active_tunable) {
       errorQuda("Unexpected call to tuneLaunch() in %s::apply()", typeid(tunable).name());
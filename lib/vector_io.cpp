@@ -1,129 +1,414 @@
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
 #include <color_spinor_field.h>
 #include <qio_field.h>
 #include <vector_io.h>
 #include <blas_quda.h>
 #include <timer.h>
 
+#if defined(HAVE_QIO) && defined(QMP_COMMS)
+#include <mpi.h>
+#endif
+
 namespace quda
 {
 
-  VectorIO::VectorIO(const std::string &filename, bool parity_inflate, bool partfile) :
-    filename(filename), parity_inflate(parity_inflate), partfile(partfile)
+  namespace
+  {
+
+    /**
+       The VectorIO instance, if any, with an open prefetch or
+       deferred save.  QIO keeps the lattice layout in global state,
+       so at most one file may be open at a time.
+    */
+    VectorIO *in_flight = nullptr;
+
+    /**
+       @return Whether QIO may run on a worker thread.  The worker
+       communicates on a private communicator (see
+       qio_begin_private_comm) concurrently with the main thread,
+       which requires MPI to have been initialized with
+       MPI_THREAD_MULTIPLE.
+    */
+    bool threaded_io()
+    {
+#if defined(HAVE_QIO) && defined(QMP_COMMS)
+      static bool init = false;
+      static bool threaded = false;
+      if (!init) {
+        int provided = MPI_THREAD_SINGLE;
+        MPI_Query_thread(&provided);
+        threaded = provided == MPI_THREAD_MULTIPLE;
+        if (!threaded) logQuda(QUDA_VERBOSE, "MPI_THREAD_MULTIPLE not available, vector I/O will not be overlapped\n");
+        init = true;
+      }
+      return threaded;
+#else
+      return false;
+#endif
+    }
+
+    /**
+       Layout of a set of vectors as seen by QIO: each vector is split
+       into Ls 4-d fields of stride bytes, which are staged in host
+       memory in space-spin-color order at the file precision,
+       optionally inflated to full parity.
+    */
+    struct IOLayout {
+      ColorSpinorParam param; /** Reference parameters for a host staging vector */
+      int Nvec;
+      int Ls;
+      size_t stride;
+      bool inflate;
+      QudaParity parity;
+
+      IOLayout(const ColorSpinorField &v0, int Nvec, QudaPrecision prec, bool parity_inflate) :
+        param(v0),
+        Nvec(Nvec),
+        Ls(v0.Ndim() == 5 ? v0.X(4) : 1),
+        inflate(v0.SiteSubset() == QUDA_PARITY_SITE_SUBSET && parity_inflate),
+        parity(v0.SuggestedParity())
+      {
+        // since QIO routines presently assume we have 4-d fields, we need to convert to array of 4-d fields
+        if (v0.Ndim() != 4 && v0.Ndim() != 5) errorQuda("Unexpected field dimension %d", v0.Ndim());
+        if (inflate && parity != QUDA_EVEN_PARITY && parity != QUDA_ODD_PARITY)
+          errorQuda("When loading or saving single parity vectors, the suggested parity must be set.");
+
+        param.fieldOrder = QUDA_SPACE_SPIN_COLOR_FIELD_ORDER;
+        param.setPrecision(prec);
+        param.location = QUDA_CPU_FIELD_LOCATION;
+        param.create = QUDA_REFERENCE_FIELD_CREATE;
+        if (inflate) {
+          param.x[0] *= 2;                          // corrects for the factor of two in the X direction
+          param.siteSubset = QUDA_FULL_SITE_SUBSET; // create a full-parity field.
+        }
+        stride = (v0.Volume() / Ls) * (inflate ? 2 : 1) * v0.Ncolor() * v0.Nspin() * 2 * prec;
+      }
+
+      bool operator==(const IOLayout &l) const
+      {
+        return Nvec == l.Nvec && Ls == l.Ls && stride == l.stride && inflate == l.inflate && parity == l.parity
+          && param.Precision() == l.param.Precision();
+      }
+
+      /** Records must hold whole vectors for them to be staged */
+      void check_record(int first, int n) const
+      {
+        if (first % Ls != 0 || n % Ls != 0)
+          errorQuda("QIO record [%d, %d) is not aligned to whole vectors (Ls = %d)", first, first + n, Ls);
+      }
+
+      /**
+         Convert vector src into the host staging buffer
+      */
+      void stage_out(const ColorSpinorField &src, void *buffer) const
+      {
+        ColorSpinorParam csParam(param);
+        csParam.v = buffer;
+        ColorSpinorField dst(csParam);
+        if (inflate) {
+          dst.zero(); // to explicitly zero the other parity
+          // copy the single parity only eigen/singular vector into the even components of the full parity vector
+          blas::copy(parity == QUDA_EVEN_PARITY ? dst.Even() : dst.Odd(), src);
+        } else {
+          dst.copy(src);
+        }
+      }
+
+      /**
+         Convert the host staging buffer into vector dst
+      */
+      void stage_in(ColorSpinorField &dst, void *buffer) const
+      {
+        ColorSpinorParam csParam(param);
+        csParam.v = buffer;
+        ColorSpinorField src(csParam);
+        if (inflate)
+          dst.copy(parity == QUDA_EVEN_PARITY ? src.Even() : src.Odd());
+        else
+          dst.copy(src);
+      }
+    };
+
+  } // namespace
+
+  /**
+     An open QIO file and a bounded queue of host staging slots.  The
+     file is owned by a worker thread, which reads records into slots
+     ahead of the calling thread (load and prefetch) or writes the
+     slots the calling thread has staged (save_async), while the
+     calling thread converts vectors to and from the slots.  Without a
+     worker thread, the calling thread does each read or write itself
+     when it needs it.
+  */
+  struct VectorIO::Pipeline {
+    struct Slot {
+      std::vector<char> buffer;
+      int first = 0; /** First 4-d field in this slot */
+      int n = 0;     /** Number of 4-d fields in this slot */
+    };
+
+    const IOLayout layout;
+    const bool load;
+    const std::string filename;
+    const bool partfile;
+    const size_t depth; /** Maximum number of records queued */
+    const int n_field;  /** Number of 4-d fields in the file */
+
+    void *file = nullptr;    /** QIO reader or writer, only accessed by the worker */
+    int done = 0;            /** Number of 4-d fields read from or written to file, only accessed by the worker */
+    int consumed = 0;        /** Number of 4-d fields converted by load */
+    std::deque<Slot> queue;  /** Records read and awaiting conversion, or staged and awaiting write */
+    std::vector<Slot> spare; /** Buffers available for reuse */
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::thread worker;
+    quda::host_timer_t host_timer;
+
+    Pipeline(const IOLayout &layout, bool load, const std::string &filename, bool partfile, size_t depth) :
+      layout(layout),
+      load(load),
+      filename(filename),
+      partfile(partfile),
+      depth(depth),
+      n_field(layout.Nvec * layout.Ls)
+    {
+      host_timer.start();
+      if (threaded_io()) {
+        qio_begin_private_comm(layout.param.x.data, layout.param.siteSubset);
+        worker = std::thread([this] { run(); });
+      }
+    }
+
+    /** Worker thread: read ahead while the queue has room, or write whatever is queued */
+    void run()
+    {
+      while (done < n_field) {
+        {
+          std::unique_lock<std::mutex> lock(mutex);
+          cv.wait(lock, [&] { return load ? queue.size() < depth : !queue.empty(); });
+        }
+        load ? read_ahead() : write_back();
+      }
+    }
+
+    /** Return a slot to fill, reusing a spare buffer where possible */
+    Slot take()
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      if (spare.empty()) return Slot();
+      Slot s = std::move(spare.back());
+      spare.pop_back();
+      return s;
+    }
+
+    /** Return a slot's buffer for reuse */
+    void recycle(Slot &&s)
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      spare.push_back(std::move(s));
+    }
+
+    /** Read the next record into the queue */
+    void read_ahead()
+    {
+      if (!file) file = open_spinor_field_reader(filename.c_str(), layout.param.x.data, layout.param.siteSubset);
+
+      Slot s = take();
+      std::vector<void *> V;
+      read_spinor_field_record(file, layout.param.Precision(), layout.param.nColor, layout.param.nSpin, n_field - done,
+                               [&](int n) -> void ** {
+                                 layout.check_record(done, n);
+                                 s.first = done;
+                                 s.n = n;
+                                 s.buffer.resize(n * layout.stride);
+                                 V.resize(n);
+                                 for (int k = 0; k < n; k++) V[k] = s.buffer.data() + k * layout.stride;
+                                 return V.data();
+                               });
+      done += s.n;
+      // release QIO as soon as the whole file has been read
+      if (done == n_field) close_spinor_field_reader(file);
+
+      {
+        std::lock_guard<std::mutex> lock(mutex);
+        queue.push_back(std::move(s));
+      }
+      cv.notify_all();
+    }
+
+    /** Write the oldest queued slot as the next record */
+    void write_back()
+    {
+      if (!file)
+        file = open_spinor_field_writer(filename.c_str(), layout.param.x.data, layout.param.siteSubset, partfile);
+
+      // the slot stays queued while it is written, so that it counts against the depth
+      Slot *s;
+      {
+        std::lock_guard<std::mutex> lock(mutex);
+        s = &queue.front();
+      }
+      std::vector<const void *> V(s->n);
+      for (int k = 0; k < s->n; k++) V[k] = s->buffer.data() + k * layout.stride;
+      write_spinor_field_record(file, V.data(), layout.param.Precision(), layout.param.siteSubset, layout.parity,
+                                layout.param.nColor, layout.param.nSpin, s->n);
+      done += s->n;
+      if (done == n_field) close_spinor_field_writer(file);
+
+      {
+        std::lock_guard<std::mutex> lock(mutex);
+        spare.push_back(std::move(queue.front()));
+        queue.pop_front();
+      }
+      cv.notify_all();
+    }
+
+    /** Queue a staged slot to be written, waiting while the queue is full */
+    void push(Slot &&s)
+    {
+      {
+        std::unique_lock<std::mutex> lock(mutex);
+        cv.wait(lock, [&] { return !worker.joinable() || queue.size() < depth; });
+        queue.push_back(std::move(s));
+      }
+      cv.notify_all();
+      if (!worker.joinable()) write_back();
+    }
+
+    /** Dequeue the next record read, waiting for it if need be */
+    Slot pop()
+    {
+      if (!worker.joinable()) read_ahead();
+      Slot s;
+      {
+        std::unique_lock<std::mutex> lock(mutex);
+        cv.wait(lock, [&] { return !queue.empty(); });
+        s = std::move(queue.front());
+        queue.pop_front();
+      }
+      cv.notify_all();
+      consumed += s.n;
+      return s;
+    }
+
+    /**
+       Complete the transfer: an unconsumed read is drained, since the
+       record reads are collective and must be matched on every rank,
+       and the worker is joined.
+    */
+    void finish()
+    {
+      if (load)
+        while (consumed < n_field) recycle(pop());
+      if (worker.joinable()) {
+        worker.join();
+        qio_end_private_comm();
+      }
+      host_timer.stop();
+    }
+  };
+
+  VectorIO::VectorIO(const std::string &filename, bool parity_inflate, bool partfile, uint32_t chunk_size,
+                     uint32_t async_depth) :
+    filename(filename),
+    parity_inflate(parity_inflate),
+    partfile(partfile),
+    chunk_size(chunk_size),
+    async_depth(std::max(async_depth, 1u))
   {
     if (strcmp(filename.c_str(), "") == 0)
       errorQuda("No eigenspace input file defined (filename = %s, parity_inflate = %d", filename.c_str(), parity_inflate);
   }
 
+  VectorIO::~VectorIO() { wait(); }
+
+  void VectorIO::wait()
+  {
+    if (!pipeline) return;
+
+    auto &p = *pipeline;
+    if (p.load && p.consumed < p.n_field)
+      logQuda(QUDA_VERBOSE, "Discarding unconsumed prefetch of vectors from %s\n", filename.c_str());
+    p.finish();
+    if (!p.load) {
+      logQuda(QUDA_SUMMARIZE, "Time spent saving vectors to %s = %g secs\n", filename.c_str(), p.host_timer.last());
+      if (getVerbosity() >= QUDA_SUMMARIZE) printfQuda("Done saving vectors\n");
+    }
+    pipeline.reset();
+    if (in_flight == this) in_flight = nullptr;
+  }
+
   void VectorIO::load(cvector_ref<ColorSpinorField> &vecs)
   {
     const ColorSpinorField &v0 = vecs[0];
     const int Nvec = vecs.size();
     const QudaPrecision load_prec = v0.Precision() < QUDA_SINGLE_PRECISION ? QUDA_SINGLE_PRECISION : v0.Precision();
+    IOLayout layout(v0, Nvec, load_prec, parity_inflate);
+    const int Ls = layout.Ls;
 
-    auto spinor_parity = v0.SuggestedParity();
-    if (v0.SiteSubset() == QUDA_PARITY_SITE_SUBSET && parity_inflate &&
-        spinor_parity != QUDA_EVEN_PARITY && spinor_parity != QUDA_ODD_PARITY)
-      errorQuda("When loading single parity vectors, the suggested parity must be set.");
     if (getVerbosity() >= QUDA_SUMMARIZE) printfQuda("Start loading %04d vectors from %s\n", Nvec, filename.c_str());
 
-    std::vector<ColorSpinorField> tmp(Nvec);
-    bool create_tmp = load_prec != v0.Precision() || (v0.SiteSubset() == QUDA_PARITY_SITE_SUBSET && parity_inflate) ||
-      v0.Location() == QUDA_CUDA_FIELD_LOCATION;
-
-    if (create_tmp) {
-      ColorSpinorParam csParam(vecs[0]);
-      csParam.fieldOrder = QUDA_SPACE_SPIN_COLOR_FIELD_ORDER;
-      csParam.setPrecision(load_prec);
-      csParam.location = QUDA_CPU_FIELD_LOCATION;
-      csParam.create = QUDA_NULL_FIELD_CREATE;
-      if (csParam.siteSubset == QUDA_PARITY_SITE_SUBSET && parity_inflate) {
-        csParam.x[0] *= 2;
-        csParam.siteSubset = QUDA_FULL_SITE_SUBSET;
-      }
-      for (int i = 0; i < Nvec; i++) tmp[i] = ColorSpinorField(csParam);
+    // continue from a matching prefetch, else start reading from scratch
+    std::unique_ptr<Pipeline> p;
+    if (pipeline && pipeline->load && pipeline->layout == layout) {
+      p = std::move(pipeline);
+      if (in_flight == this) in_flight = nullptr;
+    } else {
+      wait();
+      if (in_flight) in_flight->wait();
+      p = std::make_unique<Pipeline>(layout, true, filename, partfile, async_depth);
     }
 
-    if (v0.Ndim() == 4 || v0.Ndim() == 5) {
-      // since QIO routines presently assume we have 4-d fields, we need to convert to array of 4-d fields
-      auto Ls = v0.Ndim() == 5 ? v0.X(4) : 1;
-      auto V4 = v0.Volume() / Ls;
-      if (v0.SiteSubset() == QUDA_PARITY_SITE_SUBSET && parity_inflate) V4 *= 2;
-      auto stride = V4 * v0.Ncolor() * v0.Nspin() * 2 * v0.Precision();
-      std::vector<void *> V(Nvec * Ls);
-      for (int i = 0; i < Nvec; i++) {
-        auto &v = create_tmp ? tmp[i] : vecs[i];
-        for (int j = 0; j < Ls; j++) { V[i * Ls + j] = v.data<char *>() + j * stride; }
-      }
-
-      // if we're loading inflated vectors, we need to grab the spinor size from `tmp` instead of `v0`.
-      auto spinor_X = (create_tmp && parity_inflate) ? tmp[0].X() : v0.X();
-      auto spinor_site_subset = (create_tmp && parity_inflate) ? tmp[0].SiteSubset() : v0.SiteSubset();
+    // convert each record as it arrives, while the worker reads the next ones
+    while (p->consumed < p->n_field) {
+      auto slot = p->pop();
+      for (int i = slot.first / Ls; i < (slot.first + slot.n) / Ls; i++)
+        layout.stage_in(vecs[i], slot.buffer.data() + (i * Ls - slot.first) * layout.stride);
+      p->recycle(std::move(slot));
+    }
+    p->finish();
 
-      // time loading
-      quda::host_timer_t host_timer;
-      host_timer.start(); // start the timer
+    logQuda(QUDA_SUMMARIZE, "Time spent loading vectors from %s = %g secs\n", filename.c_str(), p->host_timer.last());
 
-      read_spinor_field(filename.c_str(), V.data(), v0.Precision(), spinor_X, spinor_site_subset, spinor_parity,
-                        v0.Ncolor(), v0.Nspin(), Nvec * Ls, 0, nullptr);
+    if (getVerbosity() >= QUDA_SUMMARIZE) printfQuda("Done loading vectors\n");
+  }
 
-      host_timer.stop(); // stop the timer
-      logQuda(QUDA_SUMMARIZE, "Time spent loading vectors from %s = %g secs\n", filename.c_str(), host_timer.last());
-    } else {
-      errorQuda("Unexpected field dimension %d", v0.Ndim());
-    }
+  void VectorIO::prefetch(cvector_ref<const ColorSpinorField> &vecs)
+  {
+    wait();
+    if (in_flight) in_flight->wait();
 
-    if (create_tmp) {
-      if (v0.SiteSubset() == QUDA_FULL_SITE_SUBSET || !parity_inflate) {
-        for (int i = 0; i < Nvec; i++) vecs[i] = tmp[i];
-      } else {
-        for (int i = 0; i < Nvec; i++) vecs[i] = spinor_parity == QUDA_EVEN_PARITY ? tmp[i].Even() : tmp[i].Odd();
-      }
-    }
+    const ColorSpinorField &v0 = vecs[0];
+    const int Nvec = vecs.size();
+    const QudaPrecision load_prec = v0.Precision() < QUDA_SINGLE_PRECISION ? QUDA_SINGLE_PRECISION : v0.Precision();
 
-    if (getVerbosity() >= QUDA_SUMMARIZE) printfQuda("Done loading vectors\n");
+    logQuda(QUDA_VERBOSE, "Prefetching up to %u records of %d vectors from %s\n", async_depth, Nvec, filename.c_str());
+    pipeline = std::make_unique<Pipeline>(IOLayout(v0, Nvec, load_prec, parity_inflate), true, filename, partfile,
+                                          async_depth);
+    in_flight = this;
   }
 
   void VectorIO::save(cvector_ref<const ColorSpinorField> &vecs, QudaPrecision prec, uint32_t size)
   {
+    save_async(vecs, prec, size);
+    wait();
+  }
+
+  void VectorIO::save_async(cvector_ref<const ColorSpinorField> &vecs, QudaPrecision prec, uint32_t size)
+  {
+    wait();
+    if (in_flight) in_flight->wait();
+
     const ColorSpinorField &v0 = vecs[0];
     const int Nvec = (size != 0 && size < vecs.size()) ? size : vecs.size();
     if (prec < QUDA_SINGLE_PRECISION && prec != QUDA_INVALID_PRECISION) errorQuda("Unsupported precision %d", prec);
     const QudaPrecision save_prec = prec != QUDA_INVALID_PRECISION ? prec :
       v0.Precision() < QUDA_SINGLE_PRECISION ? QUDA_SINGLE_PRECISION : v0.Precision();
-
-    bool create_tmp = save_prec != v0.Precision() || (v0.SiteSubset() == QUDA_PARITY_SITE_SUBSET && parity_inflate) ||
-      v0.Location() == QUDA_CUDA_FIELD_LOCATION;
-    auto spinor_parity = v0.SuggestedParity();
-    if (v0.SiteSubset() == QUDA_PARITY_SITE_SUBSET && parity_inflate &&
-        spinor_parity != QUDA_EVEN_PARITY && spinor_parity != QUDA_ODD_PARITY)
-      errorQuda("When loading single parity vectors, the suggested parity must be set.");
-    std::vector<ColorSpinorField> tmp(Nvec);
-
-    if (create_tmp) {
-      ColorSpinorParam csParam(vecs[0]);
-      csParam.fieldOrder = QUDA_SPACE_SPIN_COLOR_FIELD_ORDER;
-      csParam.setPrecision(save_prec);
-      csParam.location = QUDA_CPU_FIELD_LOCATION;
-
-      if (csParam.siteSubset == QUDA_FULL_SITE_SUBSET || !parity_inflate) {
-        // We're good, copy as is.
-        csParam.create = QUDA_NULL_FIELD_CREATE;
-        for (int i = 0; i < Nvec; i++) {
-          tmp[i] = ColorSpinorField(csParam);
-          tmp[i] = vecs[i];
-        }
-      } else { // QUDA_PARITY_SITE_SUBSET
-        csParam.x[0] *= 2;                          // corrects for the factor of two in the X direction
-        csParam.siteSubset = QUDA_FULL_SITE_SUBSET; // create a full-parity field.
-        csParam.create = QUDA_ZERO_FIELD_CREATE;    // to explicitly zero the odd sites.
-        for (int i = 0; i < Nvec; i++) {
-          tmp[i] = ColorSpinorField(csParam);
-
-          // copy the single parity only eigen/singular vector into the even components of the full parity vector
-          blas::copy(spinor_parity == QUDA_EVEN_PARITY ? tmp[i].Even() : tmp[i].Odd(), vecs[i]);
-        }
-      }
-    }
+    const int chunk = (chunk_size == 0 || chunk_size > static_cast<uint32_t>(Nvec)) ? Nvec : chunk_size;
 
     if (getVerbosity() >= QUDA_SUMMARIZE) {
       if (partfile)
@@ -132,36 +417,22 @@ namespace quda
         printfQuda("Start saving %d vectors to %s in SINGLEFILE format\n", Nvec, filename.c_str());
     }
 
-    if (v0.Ndim() == 4 || v0.Ndim() == 5) {
-      // since QIO routines presently assume we have 4-d fields, we need to convert to array of 4-d fields
-      auto Ls = v0.Ndim() == 5 ? v0.X(4) : 1;
-      auto V4 = v0.Volume() / Ls;
-      if (v0.SiteSubset() == QUDA_PARITY_SITE_SUBSET && parity_inflate) V4 *= 2;
-      auto stride = V4 * v0.Ncolor() * v0.Nspin() * 2 * v0.Precision();
-      std::vector<const void *> V(Nvec * Ls);
-      for (int i = 0; i < Nvec; i++) {
-        auto &v = create_tmp ? tmp[i] : vecs[i];
-        for (int j = 0; j < Ls; j++) { V[i * Ls + j] = v.data<const char *>() + j * stride; }
-      }
-
-      // if we performed parity inflation, we need to grab the spinor size from `tmp` instead of `v0`.
-      auto spinor_X = (create_tmp && parity_inflate) ? tmp[0].X() : v0.X();
-      auto spinor_site_subset = (create_tmp && parity_inflate) ? tmp[0].SiteSubset() : v0.SiteSubset();
-
-      // time saving
-      quda::host_timer_t host_timer;
-      host_timer.start(); // start the timer
+    pipeline = std::make_unique<Pipeline>(IOLayout(v0, Nvec, save_prec, parity_inflate), false, filename, partfile,
+                                          async_depth);
+    in_flight = this;
 
-      write_spinor_field(filename.c_str(), V.data(), save_prec, spinor_X, spinor_site_subset, spinor_parity,
-                         v0.Ncolor(), v0.Nspin(), Nvec * Ls, 0, nullptr, partfile);
-
-      host_timer.stop(); // stop the timer
-      logQuda(QUDA_SUMMARIZE, "Time spent saving vectors to %s = %g secs\n", filename.c_str(), host_timer.last());
-    } else {
-      errorQuda("Unexpected field dimension %d", v0.Ndim());
+    // stage each chunk while the worker writes the previous ones
+    auto &p = *pipeline;
+    const int Ls = p.layout.Ls;
+    for (int first = 0; first < Nvec; first += chunk) {
+      auto slot = p.take();
+      slot.first = first * Ls;
+      slot.n = std::min(chunk, Nvec - first) * Ls;
+      slot.buffer.resize(slot.n * p.layout.stride);
+      for (int i = 0; i < slot.n / Ls; i++)
+        p.layout.stage_out(vecs[first + i], slot.buffer.data() + i * Ls * p.layout.stride);
+      p.push(std::move(slot));
     }
-
-    if (getVerbosity() >= QUDA_SUMMARIZE) printfQuda("Done saving vectors\n");
   }
 
 } // namespace quda
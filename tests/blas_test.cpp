@@ -1084,6 +1084,101 @@ protected:
     return error;
   }
 
+  /**
+     @brief Run the multi-blas kernels directly on the host fields and
+     compare against the single-vector host kernels
+     @param[in] kernel The kernel to test
+     @return The relative deviation, or -1 if the kernel has no host test
+   */
+  double host_test(Kernel kernel)
+  {
+    std::vector<quda::Complex> A(Nsrc * Msrc);
+    std::vector<quda::Complex> B(Nsrc * Msrc);
+    std::vector<double> Ar(Nsrc * Msrc);
+    for (int i = 0; i < Nsrc * Msrc; i++) {
+      A[i] = quda::Complex(rand() / (double)RAND_MAX, rand() / (double)RAND_MAX);
+      B[i] = quda::Complex(rand() / (double)RAND_MAX, rand() / (double)RAND_MAX);
+      Ar[i] = A[i].real();
+    }
+
+    // element-wise relative deviation of a result from its reference (which is overwritten)
+    auto deviation = [](ColorSpinorField &ref, const ColorSpinorField &out) {
+      double ref2 = blas::norm2(ref);
+      return sqrt(blas::xmyNorm(out, ref) / ref2);
+    };
+
+    // reference copies of the y fields, updated by the single-vector kernels
+    std::vector<ColorSpinorField> refH;
+    for (int j = 0; j < Msrc; j++) refH.push_back(ymH[j]);
+
+    double error = 0.0;
+    switch (kernel) {
+    case Kernel::axpy_block:
+      blas::block::axpy(Ar, xmH, ymH);
+      for (int j = 0; j < Msrc; j++) {
+        for (int i = 0; i < Nsrc; i++) { blas::axpy(Ar[Msrc * i + j], xmH[i], refH[j]); }
+        error += deviation(refH[j], ymH[j]);
+      }
+      error /= Msrc;
+      break;
+
+    case Kernel::caxpy_block:
+      blas::block::caxpy(A, xmH, ymH);
+      for (int j = 0; j < Msrc; j++) {
+        for (int i = 0; i < Nsrc; i++) { blas::caxpy(A[Msrc * i + j], xmH[i], refH[j]); }
+        error += deviation(refH[j], ymH[j]);
+      }
+      error /= Msrc;
+      break;
+
+    case Kernel::axpyz_block:
+      blas::block::axpyz(Ar, xmH, ymH, wmH);
+      for (int j = 0; j < Msrc; j++) {
+        for (int i = 0; i < Nsrc; i++) { blas::axpy(Ar[Msrc * i + j], xmH[i], refH[j]); }
+        error += deviation(refH[j], wmH[j]);
+      }
+      error /= Msrc;
+      break;
+
+    case Kernel::caxpyz_block:
+      blas::block::caxpyz(A, xmH, ymH, wmH);
+      for (int j = 0; j < Msrc; j++) {
+        for (int i = 0; i < Nsrc; i++) { blas::caxpy(A[Msrc * i + j], xmH[i], refH[j]); }
+        error += deviation(refH[j], wmH[j]);
+      }
+      error /= Msrc;
+      break;
+
+    case Kernel::cDotProduct_block:
+      blas::block::cDotProduct(A, xmH, ymH);
+      for (int i = 0; i < Nsrc; i++) {
+        for (int j = 0; j < Msrc; j++) {
+          B[i * Msrc + j] = blas::cDotProduct(xmH[i], ymH[j]);
+          error += std::abs(A[i * Msrc + j] - B[i * Msrc + j]) / std::abs(B[i * Msrc + j]);
+        }
+      }
+      error /= Nsrc * Msrc;
+      break;
+
+    case Kernel::hDotProduct_block: {
+      std::vector<quda::Complex> H(Nsrc * Nsrc);
+      blas::block::hDotProduct(H, xmH, xmH);
+      for (int i = 0; i < Nsrc; i++) {
+        for (int j = 0; j < Nsrc; j++) {
+          auto ref = blas::cDotProduct(xmH[i], xmH[j]);
+          error += std::abs(H[i * Nsrc + j] - ref) / std::abs(ref);
+        }
+      }
+      error /= Nsrc * Nsrc;
+      break;
+    }
+
+    default: return -1.0;
+    }
+
+    return error;
+  }
+
   ::testing::tuple<int, int> param;
   const prec_pair_t prec_pair;
   const int &kernel;
@@ -1176,6 +1271,19 @@ TEST_P(BlasTest, verify)
   EXPECT_EQ(false, std::isnan(deviation)) << "Nan has propagated into the result";
 }
 
+TEST_P(BlasTest, host_verify)
+{
+  prec_pair_t prec_pair = ::prec_idx_map(testing::get<0>(GetParam()));
+  Kernel kernel = (Kernel)::testing::get<1>(GetParam());
+  // the host fields are always double precision, so only run once per kernel
+  if (skip_kernel(prec_pair, kernel) || prec_pair.first != QUDA_DOUBLE_PRECISION) GTEST_SKIP();
+
+  double deviation = host_test(kernel);
+  if (deviation < 0.0) GTEST_SKIP();
+  EXPECT_LE(deviation, 1e-12) << "CPU multi-blas and CPU blas implementations do not agree";
+  EXPECT_EQ(false, std::isnan(deviation)) << "Nan has propagated into the result";
+}
+
 TEST_P(BlasTest, benchmark)
 {
   prec_pair_t prec_pair = prec_idx_map(::testing::get<0>(GetParam()));
@@ -133,7 +133,7 @@ void init(int argc, char **argv)
   }
 }
 
-std::vector<double> eigensolve(test_t test_param)
+std::vector<double> eigensolve(test_t test_param, std::vector<__complex__ double> *evals_out)
 {
   // Collect testing parameters from gtest
   eig_inv_param.cuda_prec = ::testing::get<0>(test_param);
@@ -224,6 +224,8 @@ std::vector<double> eigensolve(test_t test_param)
   host_timer.stop();
   printfQuda("Time for %s solution = %f\n", eig_param.arpack_check ? "ARPACK" : "QUDA", host_timer.last());
 
+  if (evals_out) *evals_out = evals;
+
   std::vector<double> residua(eig_n_conv, 0.0);
   // Perform host side verification of eigenvector if requested.
   if (verify_results) {
@@ -1,3 +1,4 @@
+#include <fstream>
 #include <instantiate.h>
 #include <gtest/gtest.h>
 
@@ -58,7 +59,7 @@ public:
   }
 };
 
-std::vector<double> eigensolve(test_t test_param);
+std::vector<double> eigensolve(test_t test_param, std::vector<__complex__ double> *evals_out = nullptr);
 
 TEST_P(EigensolveTest, verify)
 {
@@ -77,6 +78,77 @@ TEST_P(EigensolveTest, verify)
   for (auto rsd : eigensolve(GetParam())) EXPECT_LE(rsd, tol);
 }
 
+class EigensolveCheckpointTest : public EigensolveTest
+{
+};
+
+bool checkpoint_file_exists(const std::string &path)
+{
+  std::string name = path;
+  if (eig_param.partfile == QUDA_BOOLEAN_TRUE && path.compare(path.size() - 5, 5, ".meta") != 0) {
+    char suffix[16];
+    snprintf(suffix, sizeof(suffix), ".vol%04d", quda::comm_rank());
+    name += suffix;
+  }
+  return std::ifstream(name.c_str()).good();
+}
+
+TEST_P(EigensolveCheckpointTest, resume)
+{
+  if (skip_test(GetParam())) GTEST_SKIP();
+#ifndef HAVE_QIO
+  GTEST_SKIP() << "Checkpointing requires QIO";
+#endif
+  if (eig_param.arpack_check) GTEST_SKIP();
+
+  auto tol = ::testing::get<0>(GetParam()) == QUDA_SINGLE_PRECISION ? 1e-5 : 1e-12;
+  eig_param.tol = tol;
+  if (::testing::get<1>(GetParam()) == QUDA_EIG_IR_ARNOLDI) tol *= 15;
+
+  const std::string checkpoint_file = "eigensolve_checkpoint_test";
+  const std::vector<std::string> checkpoint_paths
+    = {checkpoint_file + ".meta", checkpoint_file + ".vec0", checkpoint_file + ".vec1"};
+  const std::string old_checkpoint_file = eig_param.checkpoint_file;
+  const int old_checkpoint_interval = eig_param.checkpoint_interval;
+  const int old_max_restarts = eig_param.max_restarts;
+  const QudaBoolean old_require_convergence = eig_param.require_convergence;
+
+  // uninterrupted reference run
+  eig_param.checkpoint_file[0] = '\0';
+  std::vector<__complex__ double> ref_evals;
+  eigensolve(GetParam(), &ref_evals);
+
+  // a run stopped after its first restart leaves a checkpoint behind
+  strcpy(eig_param.checkpoint_file, checkpoint_file.c_str());
+  eig_param.checkpoint_interval = 1;
+  eig_param.max_restarts = 1;
+  eig_param.require_convergence = QUDA_BOOLEAN_FALSE;
+  eigensolve(GetParam());
+  const bool interrupted = checkpoint_file_exists(checkpoint_paths[0]);
+
+  // resuming from it must reproduce the uninterrupted run
+  eig_param.max_restarts = old_max_restarts;
+  eig_param.require_convergence = old_require_convergence;
+  std::vector<__complex__ double> evals;
+  auto residua = eigensolve(GetParam(), &evals);
+
+  // success removes the checkpoint
+  for (auto &path : checkpoint_paths) EXPECT_FALSE(checkpoint_file_exists(path)) << path << " was not removed";
+
+  strcpy(eig_param.checkpoint_file, old_checkpoint_file.c_str());
+  eig_param.checkpoint_interval = old_checkpoint_interval;
+
+  if (!interrupted) GTEST_SKIP() << "Eigensolver converged before its first checkpoint";
+
+  for (auto rsd : residua) EXPECT_LE(rsd, tol);
+  ASSERT_EQ(evals.size(), ref_evals.size());
+  for (auto i = 0u; i < evals.size(); i++) {
+    auto scale = std::max(1.0, std::abs(__real__ ref_evals[i]) + std::abs(__imag__ ref_evals[i]));
+    EXPECT_NEAR(__real__ evals[i], __real__ ref_evals[i], tol * scale) << "eigenvalue " << i;
+    EXPECT_NEAR(__imag__ evals[i], __imag__ ref_evals[i], tol * scale) << "eigenvalue " << i;
+  }
+}
+
 std::string gettestname(::testing::TestParamInfo<test_t> param)
 {
   std::string name;
@@ -131,3 +203,10 @@ INSTANTIATE_TEST_SUITE_P(DirectFull, EigensolveTest,
                                             Values(QUDA_BOOLEAN_FALSE), Values(QUDA_BOOLEAN_FALSE),
                                             non_hermitian_spectrum),
                          gettestname);
+
+// checkpoint and resume of each restarted eigensolver
+INSTANTIATE_TEST_SUITE_P(Checkpoint, EigensolveCheckpointTest,
+                         ::testing::Combine(precisions, hermitian_solvers, Values(QUDA_BOOLEAN_TRUE),
+                                            Values(QUDA_BOOLEAN_TRUE), Values(QUDA_BOOLEAN_FALSE),
+                                            Values(QUDA_SPECTRUM_SR_EIG)),
+                         gettestname);
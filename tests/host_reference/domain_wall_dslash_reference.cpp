@@ -14,6 +14,7 @@
 #include "domain_wall_dslash_reference.h"
 #include "dslash_reference.h"
 #include "gamma_reference.h"
+#include "host_stencil.h"
 
 using namespace quda;
 
@@ -35,9 +36,6 @@ template <QudaPCType type, typename real_t>
 void dslashReference_4d(real_t *out, const real_t *const *gauge, real_t const *const *ghostGauge, const real_t *in,
                         const real_t *const *fwdSpinor, const real_t *const *backSpinor, int parity, int dagger)
 {
-#pragma omp parallel for
-  for (auto i = 0lu; i < V5h * spinor_site_size; i++) out[i] = 0.0;
-
   const real_t *gaugeEven[4], *gaugeOdd[4];
   const real_t *ghostGaugeEven[4], *ghostGaugeOdd[4];
 
@@ -49,28 +47,36 @@ void dslashReference_4d(real_t *out, const real_t *const *gauge, real_t const *c
     ghostGaugeOdd[dir] = is_multi_gpu() ? ghostGauge[dir] + (faceVolume[dir] / 2) * gauge_site_size : nullptr;
   }
 
+  const HostStencil &stencil = getHostStencil(1, 1, 5, type);
+
   for (int xs = 0; xs < Ls; xs++) {
+    int gaugeOddBit = (xs % 2 == 0 || type == QUDA_4D_PC) ? parity : (parity + 1) % 2;
+
 #pragma omp parallel for
     for (int i = 0; i < Vh; i++) {
       int sp_idx = i + Vh * xs;
-      for (int dir = 0; dir < 8; dir++) {
-        int gaugeOddBit = (xs % 2 == 0 || type == QUDA_4D_PC) ? parity : (parity + 1) % 2;
+      const int *spinor_idx = stencil.spinorIndex(parity, sp_idx);
+      const int *gauge_idx = stencil.gaugeIndex(gaugeOddBit, i);
+      real_t accum[spinor_site_size] = {};
 
-        const real_t *gauge = gaugeLink(i, dir, gaugeOddBit, gaugeEven, gaugeOdd, ghostGaugeEven, ghostGaugeOdd, 1, 1);
-        const real_t *spinor = spinorNeighbor_5d<type>(sp_idx, dir, parity, in, fwdSpinor, backSpinor, 1, 1);
+      for (int dir = 0; dir < 8; dir++) {
+        const real_t *gauge
+          = gaugeLinkPointer(gauge_idx[dir], dir, gaugeOddBit, gaugeEven, gaugeOdd, ghostGaugeEven, ghostGaugeOdd);
+        const real_t *spinor = spinorNeighborPointer(spinor_idx[dir], dir, in, fwdSpinor, backSpinor, spinor_site_size);
 
-        real_t projectedSpinor[spinor_site_size], gaugedSpinor[spinor_site_size];
+        real_t projectedSpinor[spinor_site_size];
         int projIdx = 2 * (dir / 2) + (dir + dagger) % 2;
         multiplySpinorByDiracProjector(projectedSpinor, projIdx, spinor);
 
         for (int s = 0; s < 4; s++) {
           if (dir % 2 == 0)
-            su3Mul(&gaugedSpinor[s * (3 * 2)], gauge, &projectedSpinor[s * (3 * 2)]);
+            su3MulAdd<false>(&accum[s * (3 * 2)], gauge, &projectedSpinor[s * (3 * 2)]);
           else
-            su3Tmul(&gaugedSpinor[s * (3 * 2)], gauge, &projectedSpinor[s * (3 * 2)]);
+            su3MulAdd<true>(&accum[s * (3 * 2)], gauge, &projectedSpinor[s * (3 * 2)]);
         }
-        sum(&out[sp_idx * (4 * 3 * 2)], &out[sp_idx * (4 * 3 * 2)], gaugedSpinor, 4 * 3 * 2);
       }
+
+      for (auto c = 0lu; c < spinor_site_size; c++) out[sp_idx * spinor_site_size + c] = accum[c];
     }
   }
 }
@@ -184,6 +184,33 @@ template <typename real_t> static inline void su3Tmul(real_t *res, const real_t
   su3Mul(res, matT, vec);
 }
 
+/**
+ * @brief Accumulate an SU(3) matrix-vector product into a vector, res += sign * mat * vec, or with
+ * the Hermitian conjugate of the matrix if dagger is set, without forming any temporaries
+ *
+ * @tparam dagger Whether to use the Hermitian conjugate of the matrix
+ * @tparam real_t The floating-point type of the matrix and vector elements
+ * @param[in,out] res The 3-component vector that is accumulated into
+ * @param[in] mat The input SU(3) matrix
+ * @param[in] vec The input 3-component vector
+ * @param[in] sign The sign (+1 or -1) of the accumulation
+ */
+template <bool dagger, typename real_t>
+static inline void su3MulAdd(real_t *res, const real_t *mat, const real_t *vec, int sign = 1)
+{
+  for (int n = 0; n < 3; n++) {
+    real_t re = 0, im = 0;
+    for (int m = 0; m < 3; m++) {
+      real_t a_re = dagger ? mat[m * (3 * 2) + n * (2) + 0] : mat[n * (3 * 2) + m * (2) + 0];
+      real_t a_im = dagger ? -mat[m * (3 * 2) + n * (2) + 1] : mat[n * (3 * 2) + m * (2) + 1];
+      re += a_re * vec[2 * m + 0] - a_im * vec[2 * m + 1];
+      im += a_re * vec[2 * m + 1] + a_im * vec[2 * m + 0];
+    }
+    res[n * (2) + 0] += sign * re;
+    res[n * (2) + 1] += sign * im;
+  }
+}
+
 std::array<double, 2> verifyInversion(void *spinorOut, void *spinorIn, void *spinorCheck, QudaGaugeParam &gauge_param,
                                       QudaInvertParam &inv_param, void **gauge, void *clover, void *clover_inv,
                                       int src_idx);
@@ -278,33 +305,21 @@ double verifyStaggeredTypeSingularVector(quda::ColorSpinorField &spinor_left, qu
 double verifySpinorDistanceReweight(quda::ColorSpinorField &spinor, double alpha0, int t0);
 
 /**
- * @brief Return the pointer to a gauge link as a function of an origin and an offset
+ * @brief Return the location of a gauge link as a function of an origin and an offset.  A
+ * non-negative result j is the checkerboard index into the local gauge field, while a negative
+ * result encodes the index -(j + 1) into the ghost zone of dimension dir / 2.
  *
- * @tparam real_t The data type of the fields (e.g., float or double)
  * @param[in] i The checkerboard index of the site
  * @param[in] dir The displacement direction
  * @param[in] oddBit The parity of the site
- * @param[in] gaugeEven The even gauge fields stored in a QDP layout
- * @param[in] gaugeOdd The odd gauge fields stored in a QDP layout
- * @param[in] ghostGaugeEven The even-parity gauge ghost fields
- * @param[in] ghostGaugeOdd The odd-parity gauge ghost fields
  * @param[in] n_ghost_faces The depth of the ghost fields
  * @param[in] nbr_distance Displacement distance
- * @return A pointer to the offset gauge link
+ * @return The encoded index of the offset gauge link
  */
-template <typename real_t>
-const real_t *gaugeLink(int i, int dir, int oddBit, const real_t *const *gaugeEven, const real_t *const *gaugeOdd,
-                        const real_t *const *ghostGaugeEven, const real_t *const *ghostGaugeOdd, int n_ghost_faces,
-                        int nbr_distance)
+inline int gaugeLinkIndex(int i, int dir, int oddBit, int n_ghost_faces, int nbr_distance)
 {
   int j;
   int d = nbr_distance;
-  const real_t *const *gaugeField = [&]() -> const real_t *const * {
-    if (dir % 2 == 0)
-      return (oddBit ? gaugeOdd : gaugeEven);
-    else
-      return (oddBit ? gaugeEven : gaugeOdd);
-  }();
 
   if (dir % 2 == 0) {
     j = i;
@@ -323,41 +338,29 @@ const real_t *gaugeLink(int i, int dir, int oddBit, const real_t *const *gaugeEv
     switch (dir) {
     case 1: { //-X direction
       int new_x1 = (x1 - d + X1) % X1;
-      if (x1 - d < 0 && quda::comm_dim_partitioned(0)) {
-        const real_t *ghostGaugeField = (oddBit ? ghostGaugeEven[0] : ghostGaugeOdd[0]);
-        int offset = (n_ghost_faces + x1 - d) * X4 * X3 * X2 / 2 + (x4 * X3 * X2 + x3 * X2 + x2) / 2;
-        return &ghostGaugeField[offset * (3 * 3 * 2)];
-      }
+      if (x1 - d < 0 && quda::comm_dim_partitioned(0))
+        return -((n_ghost_faces + x1 - d) * X4 * X3 * X2 / 2 + (x4 * X3 * X2 + x3 * X2 + x2) / 2) - 1;
       j = (x4 * X3 * X2 * X1 + x3 * X2 * X1 + x2 * X1 + new_x1) / 2;
       break;
     }
     case 3: { //-Y direction
       int new_x2 = (x2 - d + X2) % X2;
-      if (x2 - d < 0 && quda::comm_dim_partitioned(1)) {
-        const real_t *ghostGaugeField = (oddBit ? ghostGaugeEven[1] : ghostGaugeOdd[1]);
-        int offset = (n_ghost_faces + x2 - d) * X4 * X3 * X1 / 2 + (x4 * X3 * X1 + x3 * X1 + x1) / 2;
-        return &ghostGaugeField[offset * (3 * 3 * 2)];
-      }
+      if (x2 - d < 0 && quda::comm_dim_partitioned(1))
+        return -((n_ghost_faces + x2 - d) * X4 * X3 * X1 / 2 + (x4 * X3 * X1 + x3 * X1 + x1) / 2) - 1;
       j = (x4 * X3 * X2 * X1 + x3 * X2 * X1 + new_x2 * X1 + x1) / 2;
       break;
     }
     case 5: { //-Z direction
       int new_x3 = (x3 - d + X3) % X3;
-      if (x3 - d < 0 && quda::comm_dim_partitioned(2)) {
-        const real_t *ghostGaugeField = (oddBit ? ghostGaugeEven[2] : ghostGaugeOdd[2]);
-        int offset = (n_ghost_faces + x3 - d) * X4 * X2 * X1 / 2 + (x4 * X2 * X1 + x2 * X1 + x1) / 2;
-        return &ghostGaugeField[offset * (3 * 3 * 2)];
-      }
+      if (x3 - d < 0 && quda::comm_dim_partitioned(2))
+        return -((n_ghost_faces + x3 - d) * X4 * X2 * X1 / 2 + (x4 * X2 * X1 + x2 * X1 + x1) / 2) - 1;
       j = (x4 * X3 * X2 * X1 + new_x3 * X2 * X1 + x2 * X1 + x1) / 2;
       break;
     }
     case 7: { //-T direction
       int new_x4 = (x4 - d + X4) % X4;
-      if (x4 - d < 0 && quda::comm_dim_partitioned(3)) {
-        const real_t *ghostGaugeField = (oddBit ? ghostGaugeEven[3] : ghostGaugeOdd[3]);
-        int offset = (n_ghost_faces + x4 - d) * X1 * X2 * X3 / 2 + (x3 * X2 * X1 + x2 * X1 + x1) / 2;
-        return &ghostGaugeField[offset * (3 * 3 * 2)];
-      }
+      if (x4 - d < 0 && quda::comm_dim_partitioned(3))
+        return -((n_ghost_faces + x4 - d) * X1 * X2 * X3 / 2 + (x3 * X2 * X1 + x2 * X1 + x1) / 2) - 1;
       j = (new_x4 * (X3 * X2 * X1) + x3 * (X2 * X1) + x2 * (X1) + x1) / 2;
       break;
     } // 7
@@ -366,9 +369,56 @@ const real_t *gaugeLink(int i, int dir, int oddBit, const real_t *const *gaugeEv
     }
   }
 
+  return j;
+}
+
+/**
+ * @brief Return the pointer to a gauge link given its encoded index from gaugeLinkIndex
+ *
+ * @tparam real_t The data type of the fields (e.g., float or double)
+ * @param[in] j The encoded index of the link
+ * @param[in] dir The displacement direction
+ * @param[in] oddBit The parity of the site
+ * @param[in] gaugeEven The even gauge fields stored in a QDP layout
+ * @param[in] gaugeOdd The odd gauge fields stored in a QDP layout
+ * @param[in] ghostGaugeEven The even-parity gauge ghost fields
+ * @param[in] ghostGaugeOdd The odd-parity gauge ghost fields
+ * @return A pointer to the offset gauge link
+ */
+template <typename real_t>
+const real_t *gaugeLinkPointer(int j, int dir, int oddBit, const real_t *const *gaugeEven,
+                               const real_t *const *gaugeOdd, const real_t *const *ghostGaugeEven,
+                               const real_t *const *ghostGaugeOdd)
+{
+  if (j < 0) return &(oddBit ? ghostGaugeEven : ghostGaugeOdd)[dir / 2][(-j - 1) * (3 * 3 * 2)];
+  const real_t *const *gaugeField = dir % 2 == 0 ? (oddBit ? gaugeOdd : gaugeEven) : (oddBit ? gaugeEven : gaugeOdd);
   return &gaugeField[dir / 2][j * (3 * 3 * 2)];
 }
 
+/**
+ * @brief Return the pointer to a gauge link as a function of an origin and an offset
+ *
+ * @tparam real_t The data type of the fields (e.g., float or double)
+ * @param[in] i The checkerboard index of the site
+ * @param[in] dir The displacement direction
+ * @param[in] oddBit The parity of the site
+ * @param[in] gaugeEven The even gauge fields stored in a QDP layout
+ * @param[in] gaugeOdd The odd gauge fields stored in a QDP layout
+ * @param[in] ghostGaugeEven The even-parity gauge ghost fields
+ * @param[in] ghostGaugeOdd The odd-parity gauge ghost fields
+ * @param[in] n_ghost_faces The depth of the ghost fields
+ * @param[in] nbr_distance Displacement distance
+ * @return A pointer to the offset gauge link
+ */
+template <typename real_t>
+const real_t *gaugeLink(int i, int dir, int oddBit, const real_t *const *gaugeEven, const real_t *const *gaugeOdd,
+                        const real_t *const *ghostGaugeEven, const real_t *const *ghostGaugeOdd, int n_ghost_faces,
+                        int nbr_distance)
+{
+  return gaugeLinkPointer(gaugeLinkIndex(i, dir, oddBit, n_ghost_faces, nbr_distance), dir, oddBit, gaugeEven,
+                          gaugeOdd, ghostGaugeEven, ghostGaugeOdd);
+}
+
 /**
  * @brief Return the pointer to a gauge link as a function of an origin and an offset
  *
@@ -402,23 +452,19 @@ inline int x4_mg(int i, int oddBit)
 }
 
 /**
- * @brief Return the pointer to a fermion field as a function of an origin and an offset
+ * @brief Return the location of a fermion field site as a function of an origin and an offset.
+ * A non-negative result j is the checkerboard index into the local field, while a negative result
+ * encodes the index -(j + 1) into the forward (even dir) or backward (odd dir) ghost zone of
+ * dimension dir / 2.
  *
- * @tparam real_t The data type of the fields (e.g., float or double)
  * @param[in] i The checkerboard index of the site
  * @param[in] dir The displacement direction
  * @param[in] oddBit The parity of the site
- * @param[in] spinorField The spinor field
- * @param[in] fwd_nbr_spinor The forward ghost region for the spinor field
- * @param[in] back_nbr_spinor The backward ghost region for the spinor field
  * @param[in] neighbor_distance Displacement distance
  * @param[in] nFace The depth of the ghost fields
- * @param[in] site_size The number of values in a single spinor (6 for staggered, 24 for Wilson)
- * @return A pointer to the offset fermion field
+ * @return The encoded index of the offset fermion field site
  */
-template <typename real_t>
-const real_t *spinorNeighbor(int i, int dir, int oddBit, const real_t *spinorField, const real_t *const *fwd_nbr_spinor,
-                             const real_t *const *back_nbr_spinor, int neighbor_distance, int nFace, int site_size = 24)
+inline int spinorNeighborIndex(int i, int dir, int oddBit, int neighbor_distance, int nFace)
 {
   int j;
   int nb = neighbor_distance;
@@ -438,7 +484,7 @@ const real_t *spinorNeighbor(int i, int dir, int oddBit, const real_t *spinorFie
     int new_x1 = (x1 + nb) % X1;
     if (x1 + nb >= X1 && quda::comm_dim_partitioned(0)) {
       int offset = (x1 + nb - X1) * X4 * X3 * X2 / 2 + (x4 * X3 * X2 + x3 * X2 + x2) / 2;
-      return fwd_nbr_spinor[0] + offset * site_size;
+      return -offset - 1;
     }
     j = (x4 * X3 * X2 * X1 + x3 * X2 * X1 + x2 * X1 + new_x1) / 2;
     break;
@@ -448,7 +494,7 @@ const real_t *spinorNeighbor(int i, int dir, int oddBit, const real_t *spinorFie
     int new_x1 = (x1 - nb + X1) % X1;
     if (x1 - nb < 0 && quda::comm_dim_partitioned(0)) {
       int offset = (x1 + nFace - nb) * X4 * X3 * X2 / 2 + (x4 * X3 * X2 + x3 * X2 + x2) / 2;
-      return back_nbr_spinor[0] + offset * site_size;
+      return -offset - 1;
     }
     j = (x4 * X3 * X2 * X1 + x3 * X2 * X1 + x2 * X1 + new_x1) / 2;
     break;
@@ -458,7 +504,7 @@ const real_t *spinorNeighbor(int i, int dir, int oddBit, const real_t *spinorFie
     int new_x2 = (x2 + nb) % X2;
     if (x2 + nb >= X2 && quda::comm_dim_partitioned(1)) {
       int offset = (x2 + nb - X2) * X4 * X3 * X1 / 2 + (x4 * X3 * X1 + x3 * X1 + x1) / 2;
-      return fwd_nbr_spinor[1] + offset * site_size;
+      return -offset - 1;
     }
     j = (x4 * X3 * X2 * X1 + x3 * X2 * X1 + new_x2 * X1 + x1) / 2;
     break;
@@ -468,7 +514,7 @@ const real_t *spinorNeighbor(int i, int dir, int oddBit, const real_t *spinorFie
     int new_x2 = (x2 - nb + X2) % X2;
     if (x2 - nb < 0 && quda::comm_dim_partitioned(1)) {
       int offset = (x2 + nFace - nb) * X4 * X3 * X1 / 2 + (x4 * X3 * X1 + x3 * X1 + x1) / 2;
-      return back_nbr_spinor[1] + offset * site_size;
+      return -offset - 1;
     }
     j = (x4 * X3 * X2 * X1 + x3 * X2 * X1 + new_x2 * X1 + x1) / 2;
     break;
@@ -478,7 +524,7 @@ const real_t *spinorNeighbor(int i, int dir, int oddBit, const real_t *spinorFie
     int new_x3 = (x3 + nb) % X3;
     if (x3 + nb >= X3 && quda::comm_dim_partitioned(2)) {
       int offset = (x3 + nb - X3) * X4 * X2 * X1 / 2 + (x4 * X2 * X1 + x2 * X1 + x1) / 2;
-      return fwd_nbr_spinor[2] + offset * site_size;
+      return -offset - 1;
     }
     j = (x4 * X3 * X2 * X1 + new_x3 * X2 * X1 + x2 * X1 + x1) / 2;
     break;
@@ -488,7 +534,7 @@ const real_t *spinorNeighbor(int i, int dir, int oddBit, const real_t *spinorFie
     int new_x3 = (x3 - nb + X3) % X3;
     if (x3 - nb < 0 && quda::comm_dim_partitioned(2)) {
       int offset = (x3 + nFace - nb) * X4 * X2 * X1 / 2 + (x4 * X2 * X1 + x2 * X1 + x1) / 2;
-      return back_nbr_spinor[2] + offset * site_size;
+      return -offset - 1;
     }
     j = (x4 * X3 * X2 * X1 + new_x3 * X2 * X1 + x2 * X1 + x1) / 2;
     break;
@@ -499,7 +545,7 @@ const real_t *spinorNeighbor(int i, int dir, int oddBit, const real_t *spinorFie
     int x4 = x4_mg(i, oddBit);
     if ((x4 + nb) >= Z[3] && quda::comm_dim_partitioned(3)) {
       int offset = (x4 + nb - Z[3]) * Vsh_t;
-      return &fwd_nbr_spinor[3][(offset + j) * site_size];
+      return -(offset + j) - 1;
     }
     break;
   }
@@ -509,14 +555,57 @@ const real_t *spinorNeighbor(int i, int dir, int oddBit, const real_t *spinorFie
     int x4 = x4_mg(i, oddBit);
     if ((x4 - nb) < 0 && quda::comm_dim_partitioned(3)) {
       int offset = (x4 - nb + nFace) * Vsh_t;
-      return &back_nbr_spinor[3][(offset + j) * site_size];
+      return -(offset + j) - 1;
     }
     break;
   }
   default: j = -1; errorQuda("ERROR: wrong dir");
   }
 
-  return &spinorField[j * site_size];
+  return j;
+}
+
+/**
+ * @brief Return the pointer to a fermion field site given its encoded index from spinorNeighborIndex
+ *
+ * @tparam real_t The data type of the fields (e.g., float or double)
+ * @param[in] j The encoded index of the site
+ * @param[in] dir The displacement direction
+ * @param[in] spinorField The spinor field
+ * @param[in] fwd_nbr_spinor The forward ghost region for the spinor field
+ * @param[in] back_nbr_spinor The backward ghost region for the spinor field
+ * @param[in] site_size The number of values in a single spinor (6 for staggered, 24 for Wilson)
+ * @return A pointer to the offset fermion field
+ */
+template <typename real_t>
+const real_t *spinorNeighborPointer(int j, int dir, const real_t *spinorField, const real_t *const *fwd_nbr_spinor,
+                                    const real_t *const *back_nbr_spinor, int site_size)
+{
+  if (j < 0) return (dir % 2 == 0 ? fwd_nbr_spinor : back_nbr_spinor)[dir / 2] + (-j - 1) * site_size;
+  return spinorField + j * site_size;
+}
+
+/**
+ * @brief Return the pointer to a fermion field as a function of an origin and an offset
+ *
+ * @tparam real_t The data type of the fields (e.g., float or double)
+ * @param[in] i The checkerboard index of the site
+ * @param[in] dir The displacement direction
+ * @param[in] oddBit The parity of the site
+ * @param[in] spinorField The spinor field
+ * @param[in] fwd_nbr_spinor The forward ghost region for the spinor field
+ * @param[in] back_nbr_spinor The backward ghost region for the spinor field
+ * @param[in] neighbor_distance Displacement distance
+ * @param[in] nFace The depth of the ghost fields
+ * @param[in] site_size The number of values in a single spinor (6 for staggered, 24 for Wilson)
+ * @return A pointer to the offset fermion field
+ */
+template <typename real_t>
+const real_t *spinorNeighbor(int i, int dir, int oddBit, const real_t *spinorField, const real_t *const *fwd_nbr_spinor,
+                             const real_t *const *back_nbr_spinor, int neighbor_distance, int nFace, int site_size = 24)
+{
+  return spinorNeighborPointer(spinorNeighborIndex(i, dir, oddBit, neighbor_distance, nFace), dir, spinorField,
+                               fwd_nbr_spinor, back_nbr_spinor, site_size);
 }
 
 /**
@@ -554,24 +643,17 @@ template <QudaPCType type> int x4_5d_mgpu(int i, int oddBit)
 }
 
 /**
- * @brief Return the pointer to a 5-d fermion field as a function of an origin and an offset
+ * @brief Return the location of a 5-d fermion field site as a function of an origin and an
+ * offset, encoded as for spinorNeighborIndex
  * @tparam type The PCType, either QUDA_5D_PC or QUDA_4D_PC
- * @tparam real_t The data type of the fields (e.g., float or double)
  * @param[in] i The checkerboard index of the site
  * @param[in] dir The displacement direction
  * @param[in] oddBit The parity of the site
- * @param[in] spinorField The spinor field
- * @param[in] fwd_nbr_spinor The forward ghost region for the spinor field
- * @param[in] back_nbr_spinor The backward ghost region for the spinor field
  * @param[in] neighbor_distance Displacement distance
  * @param[in] nFace The depth of the ghost fields
- * @param[in] site_size The number of values in a single spinor (6 for staggered, 24 for Wilson)
- * @return A pointer to the offset fermion field
+ * @return The encoded index of the offset fermion field site
  */
-template <QudaPCType type, typename real_t>
-const real_t *spinorNeighbor_5d(int i, int dir, int oddBit, const real_t *spinorField,
-                                const real_t *const *fwd_nbr_spinor, const real_t *const *back_nbr_spinor,
-                                int neighbor_distance, int nFace, int site_size = 24)
+template <QudaPCType type> int spinorNeighborIndex_5d(int i, int dir, int oddBit, int neighbor_distance, int nFace)
 {
   int j;
   int nb = neighbor_distance;
@@ -593,7 +675,7 @@ const real_t *spinorNeighbor_5d(int i, int dir, int oddBit, const real_t *spinor
     int new_x1 = (x1 + nb) % X1;
     if (x1 + nb >= X1 && quda::comm_dim_partitioned(0)) {
       int offset = ((x1 + nb - X1) * Ls * X4 * X3 * X2 + xs * X4 * X3 * X2 + x4 * X3 * X2 + x3 * X2 + x2) >> 1;
-      return fwd_nbr_spinor[0] + offset * site_size;
+      return -offset - 1;
     }
     j = (xs * X4 * X3 * X2 * X1 + x4 * X3 * X2 * X1 + x3 * X2 * X1 + x2 * X1 + new_x1) >> 1;
     break;
@@ -603,7 +685,7 @@ const real_t *spinorNeighbor_5d(int i, int dir, int oddBit, const real_t *spinor
     int new_x1 = (x1 - nb + X1) % X1;
     if (x1 - nb < 0 && quda::comm_dim_partitioned(0)) {
       int offset = ((x1 + nFace - nb) * Ls * X4 * X3 * X2 + xs * X4 * X3 * X2 + x4 * X3 * X2 + x3 * X2 + x2) >> 1;
-      return back_nbr_spinor[0] + offset * site_size;
+      return -offset - 1;
     }
     j = (xs * X4 * X3 * X2 * X1 + x4 * X3 * X2 * X1 + x3 * X2 * X1 + x2 * X1 + new_x1) >> 1;
     break;
@@ -613,7 +695,7 @@ const real_t *spinorNeighbor_5d(int i, int dir, int oddBit, const real_t *spinor
     int new_x2 = (x2 + nb) % X2;
     if (x2 + nb >= X2 && quda::comm_dim_partitioned(1)) {
       int offset = ((x2 + nb - X2) * Ls * X4 * X3 * X1 + xs * X4 * X3 * X1 + x4 * X3 * X1 + x3 * X1 + x1) >> 1;
-      return fwd_nbr_spinor[1] + offset * site_size;
+      return -offset - 1;
     }
     j = (xs * X4 * X3 * X2 * X1 + x4 * X3 * X2 * X1 + x3 * X2 * X1 + new_x2 * X1 + x1) >> 1;
     break;
@@ -623,7 +705,7 @@ const real_t *spinorNeighbor_5d(int i, int dir, int oddBit, const real_t *spinor
     int new_x2 = (x2 - nb + X2) % X2;
     if (x2 - nb < 0 && quda::comm_dim_partitioned(1)) {
       int offset = ((x2 + nFace - nb) * Ls * X4 * X3 * X1 + xs * X4 * X3 * X1 + x4 * X3 * X1 + x3 * X1 + x1) >> 1;
-      return back_nbr_spinor[1] + offset * site_size;
+      return -offset - 1;
     }
     j = (xs * X4 * X3 * X2 * X1 + x4 * X3 * X2 * X1 + x3 * X2 * X1 + new_x2 * X1 + x1) >> 1;
     break;
@@ -633,7 +715,7 @@ const real_t *spinorNeighbor_5d(int i, int dir, int oddBit, const real_t *spinor
     int new_x3 = (x3 + nb) % X3;
     if (x3 + nb >= X3 && quda::comm_dim_partitioned(2)) {
       int offset = ((x3 + nb - X3) * Ls * X4 * X2 * X1 + xs * X4 * X2 * X1 + x4 * X2 * X1 + x2 * X1 + x1) >> 1;
-      return fwd_nbr_spinor[2] + offset * site_size;
+      return -offset - 1;
     }
     j = (xs * X4 * X3 * X2 * X1 + x4 * X3 * X2 * X1 + new_x3 * X2 * X1 + x2 * X1 + x1) >> 1;
     break;
@@ -643,7 +725,7 @@ const real_t *spinorNeighbor_5d(int i, int dir, int oddBit, const real_t *spinor
     int new_x3 = (x3 - nb + X3) % X3;
     if (x3 - nb < 0 && quda::comm_dim_partitioned(2)) {
       int offset = ((x3 + nFace - nb) * Ls * X4 * X2 * X1 + xs * X4 * X2 * X1 + x4 * X2 * X1 + x2 * X1 + x1) >> 1;
-      return back_nbr_spinor[2] + offset * site_size;
+      return -offset - 1;
     }
     j = (xs * X4 * X3 * X2 * X1 + x4 * X3 * X2 * X1 + new_x3 * X2 * X1 + x2 * X1 + x1) >> 1;
     break;
@@ -653,7 +735,7 @@ const real_t *spinorNeighbor_5d(int i, int dir, int oddBit, const real_t *spinor
     int x4 = x4_5d_mgpu<type>(i, oddBit);
     if ((x4 + nb) >= Z[3] && quda::comm_dim_partitioned(3)) {
       int offset = ((x4 + nb - Z[3]) * Ls * X3 * X2 * X1 + xs * X3 * X2 * X1 + x3 * X2 * X1 + x2 * X1 + x1) >> 1;
-      return fwd_nbr_spinor[3] + offset * site_size;
+      return -offset - 1;
     }
     j = neighborIndex_5d<type>(i, oddBit, 0, +nb, 0, 0, 0);
     break;
@@ -663,7 +745,7 @@ const real_t *spinorNeighbor_5d(int i, int dir, int oddBit, const real_t *spinor
     int x4 = x4_5d_mgpu<type>(i, oddBit);
     if ((x4 - nb) < 0 && quda::comm_dim_partitioned(3)) {
       int offset = ((x4 - nb + nFace) * Ls * X3 * X2 * X1 + xs * X3 * X2 * X1 + x3 * X2 * X1 + x2 * X1 + x1) >> 1;
-      return back_nbr_spinor[3] + offset * site_size;
+      return -offset - 1;
     }
     j = neighborIndex_5d<type>(i, oddBit, 0, -nb, 0, 0, 0);
     break;
@@ -673,7 +755,31 @@ const real_t *spinorNeighbor_5d(int i, int dir, int oddBit, const real_t *spinor
   default: j = -1; errorQuda("ERROR: wrong dir");
   }
 
-  return &spinorField[j * site_size];
+  return j;
+}
+
+/**
+ * @brief Return the pointer to a 5-d fermion field as a function of an origin and an offset
+ * @tparam type The PCType, either QUDA_5D_PC or QUDA_4D_PC
+ * @tparam real_t The data type of the fields (e.g., float or double)
+ * @param[in] i The checkerboard index of the site
+ * @param[in] dir The displacement direction
+ * @param[in] oddBit The parity of the site
+ * @param[in] spinorField The spinor field
+ * @param[in] fwd_nbr_spinor The forward ghost region for the spinor field
+ * @param[in] back_nbr_spinor The backward ghost region for the spinor field
+ * @param[in] neighbor_distance Displacement distance
+ * @param[in] nFace The depth of the ghost fields
+ * @param[in] site_size The number of values in a single spinor (6 for staggered, 24 for Wilson)
+ * @return A pointer to the offset fermion field
+ */
+template <QudaPCType type, typename real_t>
+const real_t *spinorNeighbor_5d(int i, int dir, int oddBit, const real_t *spinorField,
+                                const real_t *const *fwd_nbr_spinor, const real_t *const *back_nbr_spinor,
+                                int neighbor_distance, int nFace, int site_size = 24)
+{
+  return spinorNeighborPointer(spinorNeighborIndex_5d<type>(i, dir, oddBit, neighbor_distance, nFace), dir,
+                               spinorField, fwd_nbr_spinor, back_nbr_spinor, site_size);
 }
 
 /**
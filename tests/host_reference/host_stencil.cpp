@@ -0,0 +1,83 @@
+#include <algorithm>
+#include <array>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "host_utils.h"
+#include "dslash_reference.h"
+#include "host_stencil.h"
+
+HostStencil::HostStencil(int n_dim, QudaPCType pc_type, int nbr_distance, int nFace)
+{
+  const int n_site = n_dim == 5 ? V5h : Vh;
+
+  for (int parity = 0; parity < 2; parity++) {
+    spinor[parity].resize(n_site * 8);
+    gauge[parity].resize(Vh * 8);
+
+#pragma omp parallel for
+    for (int i = 0; i < n_site; i++) {
+      for (int dir = 0; dir < 8; dir++) {
+        spinor[parity][i * 8 + dir] = n_dim == 4 ? spinorNeighborIndex(i, dir, parity, nbr_distance, nFace) :
+          pc_type == QUDA_5D_PC ? spinorNeighborIndex_5d<QUDA_5D_PC>(i, dir, parity, nbr_distance, nFace) :
+                                  spinorNeighborIndex_5d<QUDA_4D_PC>(i, dir, parity, nbr_distance, nFace);
+      }
+    }
+
+#pragma omp parallel for
+    for (int i = 0; i < Vh; i++) {
+      for (int dir = 0; dir < 8; dir++)
+        gauge[parity][i * 8 + dir] = gaugeLinkIndex(i, dir, parity, nbr_distance, nbr_distance);
+    }
+  }
+}
+
+namespace
+{
+
+  /**
+   * Everything the tables depend on: the local lattice, the partitioning and the stencil shape
+   */
+  struct HostStencilKey {
+    std::array<int, 4> X;
+    int Ls;
+    int partitioned;
+    int n_dim;
+    QudaPCType pc_type;
+    int nbr_distance;
+    int nFace;
+
+    bool operator==(const HostStencilKey &key) const
+    {
+      return X == key.X && Ls == key.Ls && partitioned == key.partitioned && n_dim == key.n_dim
+        && pc_type == key.pc_type && nbr_distance == key.nbr_distance && nFace == key.nFace;
+    }
+  };
+
+  // a handful of stencils (e.g., Wilson plus naive and long-link staggered) are live at once
+  constexpr size_t max_cached_stencils = 8;
+
+  std::vector<std::pair<HostStencilKey, std::unique_ptr<HostStencil>>> stencil_cache;
+
+} // namespace
+
+const HostStencil &getHostStencil(int nbr_distance, int nFace, int n_dim, QudaPCType pc_type)
+{
+  int partitioned = 0;
+  for (int d = 0; d < 4; d++) partitioned |= quda::comm_dim_partitioned(d) << d;
+  HostStencilKey key = {{Z[0], Z[1], Z[2], Z[3]}, n_dim == 5 ? Ls : 1, partitioned, n_dim,
+                        n_dim == 5 ? pc_type : QUDA_4D_PC, nbr_distance, nFace};
+
+  // keep the cache in least-recently-used order, so that a stencil fetched just before this one stays live
+  for (auto it = stencil_cache.begin(); it != stencil_cache.end(); it++) {
+    if (it->first == key) {
+      std::rotate(it, it + 1, stencil_cache.end());
+      return *stencil_cache.back().second;
+    }
+  }
+
+  if (stencil_cache.size() == max_cached_stencils) stencil_cache.erase(stencil_cache.begin());
+  stencil_cache.emplace_back(key, std::make_unique<HostStencil>(n_dim, pc_type, nbr_distance, nFace));
+  return *stencil_cache.back().second;
+}
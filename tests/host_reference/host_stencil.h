@@ -0,0 +1,51 @@
+#pragma once
+
+#include <vector>
+#include <enum_quda.h>
+
+/**
+ * @brief Precomputed neighbor tables for the host reference stencils.  For both parities and
+ * every site these hold the encoded indices returned by spinorNeighborIndex (or
+ * spinorNeighborIndex_5d) and gaugeLinkIndex in all eight 4-d directions, so the reference
+ * Dslash operators need not recompute lattice coordinates and ghost offsets on every
+ * application.  The tables are site-major, so a site loop streams through them.
+ */
+class HostStencil
+{
+  std::vector<int> spinor[2]; /** Spinor neighbor indices, [parity][site * 8 + dir] */
+  std::vector<int> gauge[2];  /** Gauge link indices, [parity][4-d site * 8 + dir] */
+
+public:
+  /**
+   * @brief Build the tables for the current lattice geometry and partitioning
+   * @param[in] n_dim The dimensionality of the fermion field (4 or 5)
+   * @param[in] pc_type The preconditioning type of a 5-d fermion field
+   * @param[in] nbr_distance Displacement distance
+   * @param[in] nFace The depth of the ghost fields
+   */
+  HostStencil(int n_dim, QudaPCType pc_type, int nbr_distance, int nFace);
+
+  /**
+   * @brief Return the encoded spinor neighbor indices of a site in all 8 directions
+   * @param[in] parity The parity of the site
+   * @param[in] i The checkerboard index of the site
+   */
+  const int *spinorIndex(int parity, int i) const { return &spinor[parity][i * 8]; }
+
+  /**
+   * @brief Return the encoded gauge link indices of a 4-d site in all 8 directions
+   * @param[in] parity The parity of the site
+   * @param[in] i The 4-d checkerboard index of the site
+   */
+  const int *gaugeIndex(int parity, int i) const { return &gauge[parity][i * 8]; }
+};
+
+/**
+ * @brief Return the stencil tables matching the current lattice geometry and partitioning,
+ * building them on first use.  Must not be called from within a parallel region.
+ * @param[in] nbr_distance Displacement distance
+ * @param[in] nFace The depth of the ghost fields
+ * @param[in] n_dim The dimensionality of the fermion field (4 or 5)
+ * @param[in] pc_type The preconditioning type of a 5-d fermion field
+ */
+const HostStencil &getHostStencil(int nbr_distance, int nFace, int n_dim = 4, QudaPCType pc_type = QUDA_4D_PC);
@@ -12,6 +12,7 @@
 #include "util_quda.h"
 #include "staggered_dslash_reference.h"
 #include "dslash_reference.h"
+#include "host_stencil.h"
 #include "command_line_params.h"
 #include "misc.h"
 
@@ -36,9 +37,6 @@ void staggeredDslashReference(real_t *res, const real_t *const *fatlink, const r
                               const real_t *spinorField, const real_t *const *fwd_nbr_spinor,
                               const real_t *const *back_nbr_spinor, int oddBit, int daggerBit, QudaDslashType dslash_type)
 {
-#pragma omp parallel for
-  for (auto i = 0lu; i < Vh * stag_spinor_site_size; i++) res[i] = 0.0;
-
   const real_t *fatlinkEven[4], *fatlinkOdd[4];
   const real_t *longlinkEven[4], *longlinkOdd[4];
 
@@ -61,49 +59,46 @@ void staggeredDslashReference(real_t *res, const real_t *const *fatlink, const r
     }
   }
 
+  const bool asqtad = dslash_type == QUDA_ASQTAD_DSLASH;
+  const int nFace = asqtad ? 3 : 1;
+  const HostStencil &first_stencil = getHostStencil(1, nFace);
+  const HostStencil &third_stencil = getHostStencil(asqtad ? 3 : 1, nFace);
+
 #pragma omp parallel for
   for (int sid = 0; sid < Vh; sid++) {
-    int offset = stag_spinor_site_size * sid;
+    const int *first_spinor_idx = first_stencil.spinorIndex(oddBit, sid);
+    const int *fat_idx = first_stencil.gaugeIndex(oddBit, sid);
+    const int *third_spinor_idx = third_stencil.spinorIndex(oddBit, sid);
+    const int *long_idx = third_stencil.gaugeIndex(oddBit, sid);
+    real_t accum[stag_spinor_site_size] = {};
 
     for (int dir = 0; dir < 8; dir++) {
-      const int nFace = dslash_type == QUDA_ASQTAD_DSLASH ? 3 : 1;
       const real_t *fatlnk
-        = gaugeLink(sid, dir, oddBit, fatlinkEven, fatlinkOdd, ghostFatlinkEven, ghostFatlinkOdd, 1, 1);
-      const real_t *longlnk = dslash_type == QUDA_ASQTAD_DSLASH ?
-        gaugeLink(sid, dir, oddBit, longlinkEven, longlinkOdd, ghostLonglinkEven, ghostLonglinkOdd, 3, 3) :
-        nullptr;
-      const real_t *first_neighbor_spinor = spinorNeighbor(sid, dir, oddBit, spinorField, fwd_nbr_spinor,
-                                                           back_nbr_spinor, 1, nFace, stag_spinor_site_size);
-      const real_t *third_neighbor_spinor = dslash_type == QUDA_ASQTAD_DSLASH ?
-        spinorNeighbor(sid, dir, oddBit, spinorField, fwd_nbr_spinor, back_nbr_spinor, 3, nFace, stag_spinor_site_size) :
-        nullptr;
-
-      real_t gaugedSpinor[stag_spinor_site_size];
+        = gaugeLinkPointer(fat_idx[dir], dir, oddBit, fatlinkEven, fatlinkOdd, ghostFatlinkEven, ghostFatlinkOdd);
+      const real_t *first_neighbor_spinor = spinorNeighborPointer(
+        first_spinor_idx[dir], dir, spinorField, fwd_nbr_spinor, back_nbr_spinor, stag_spinor_site_size);
 
       if (dir % 2 == 0) {
-        su3Mul(gaugedSpinor, fatlnk, first_neighbor_spinor);
-        sum(&res[offset], &res[offset], gaugedSpinor, stag_spinor_site_size);
-
-        if (dslash_type == QUDA_ASQTAD_DSLASH) {
-          su3Mul(gaugedSpinor, longlnk, third_neighbor_spinor);
-          sum(&res[offset], &res[offset], gaugedSpinor, stag_spinor_site_size);
-        }
+        su3MulAdd<false>(accum, fatlnk, first_neighbor_spinor);
       } else {
-        su3Tmul(gaugedSpinor, fatlnk, first_neighbor_spinor);
-        if (dslash_type == QUDA_LAPLACE_DSLASH) {
-          sum(&res[offset], &res[offset], gaugedSpinor, stag_spinor_site_size);
-        } else {
-          sub(&res[offset], &res[offset], gaugedSpinor, stag_spinor_site_size);
-        }
-
-        if (dslash_type == QUDA_ASQTAD_DSLASH) {
-          su3Tmul(gaugedSpinor, longlnk, third_neighbor_spinor);
-          sub(&res[offset], &res[offset], gaugedSpinor, stag_spinor_site_size);
-        }
+        su3MulAdd<true>(accum, fatlnk, first_neighbor_spinor, dslash_type == QUDA_LAPLACE_DSLASH ? 1 : -1);
+      }
+
+      if (asqtad) {
+        const real_t *longlnk = gaugeLinkPointer(long_idx[dir], dir, oddBit, longlinkEven, longlinkOdd,
+                                                 ghostLonglinkEven, ghostLonglinkOdd);
+        const real_t *third_neighbor_spinor = spinorNeighborPointer(
+          third_spinor_idx[dir], dir, spinorField, fwd_nbr_spinor, back_nbr_spinor, stag_spinor_site_size);
+
+        if (dir % 2 == 0)
+          su3MulAdd<false>(accum, longlnk, third_neighbor_spinor);
+        else
+          su3MulAdd<true>(accum, longlnk, third_neighbor_spinor, -1);
       }
     } // forward/backward in all four directions
 
-    if (daggerBit) negx(&res[offset], stag_spinor_site_size);
+    real_t sign = daggerBit ? -1 : 1;
+    for (auto c = 0lu; c < stag_spinor_site_size; c++) res[stag_spinor_site_size * sid + c] = sign * accum[c];
   } // 4-d volume
 }
 
@@ -12,6 +12,7 @@
 #include "wilson_dslash_reference.h"
 #include "dslash_reference.h"
 #include "gamma_reference.h"
+#include "host_stencil.h"
 
 using namespace quda;
 
@@ -43,9 +44,6 @@ void dslashReference(real_t *res, const real_t *const *gaugeFull, const real_t *
                      const real_t *spinorField, const real_t *const *fwdSpinor, const real_t *const *backSpinor,
                      int parity, int dagger)
 {
-#pragma omp parallel for
-  for (auto i = 0lu; i < Vh * spinor_site_size; i++) res[i] = 0.0;
-
   const real_t *gaugeEven[4], *gaugeOdd[4];
   const real_t *ghostGaugeEven[4] = {nullptr, nullptr, nullptr, nullptr};
   const real_t *ghostGaugeOdd[4] = {nullptr, nullptr, nullptr, nullptr};
@@ -59,26 +57,33 @@ void dslashReference(real_t *res, const real_t *const *gaugeFull, const real_t *
     }
   }
 
+  const HostStencil &stencil = getHostStencil(1, 1);
+
 #pragma omp parallel for
   for (int i = 0; i < Vh; i++) {
+    const int *spinor_idx = stencil.spinorIndex(parity, i);
+    const int *gauge_idx = stencil.gaugeIndex(parity, i);
+    real_t accum[spinor_site_size] = {};
 
     for (int dir = 0; dir < 8; dir++) {
-      const real_t *gauge = gaugeLink(i, dir, parity, gaugeEven, gaugeOdd, ghostGaugeEven, ghostGaugeOdd, 1, 1);
-      const real_t *spinor = spinorNeighbor(i, dir, parity, spinorField, fwdSpinor, backSpinor, 1, 1);
+      const real_t *gauge
+        = gaugeLinkPointer(gauge_idx[dir], dir, parity, gaugeEven, gaugeOdd, ghostGaugeEven, ghostGaugeOdd);
+      const real_t *spinor
+        = spinorNeighborPointer(spinor_idx[dir], dir, spinorField, fwdSpinor, backSpinor, spinor_site_size);
 
-      real_t projectedSpinor[spinor_site_size], gaugedSpinor[spinor_site_size];
+      real_t projectedSpinor[spinor_site_size];
       int projIdx = 2 * (dir / 2) + (dir + dagger) % 2;
       multiplySpinorByDiracProjector(projectedSpinor, projIdx, spinor);
 
       for (int s = 0; s < 4; s++) {
         if (dir % 2 == 0)
-          su3Mul(&gaugedSpinor[s * (3 * 2)], gauge, &projectedSpinor[s * (3 * 2)]);
+          su3MulAdd<false>(&accum[s * (3 * 2)], gauge, &projectedSpinor[s * (3 * 2)]);
         else
-          su3Tmul(&gaugedSpinor[s * (3 * 2)], gauge, &projectedSpinor[s * (3 * 2)]);
+          su3MulAdd<true>(&accum[s * (3 * 2)], gauge, &projectedSpinor[s * (3 * 2)]);
       }
-
-      sum(&res[i * spinor_site_size], &res[i * spinor_site_size], gaugedSpinor, spinor_site_size);
     }
+
+    for (auto c = 0lu; c < spinor_site_size; c++) res[i * spinor_site_size + c] = accum[c];
   }
 }
 
@@ -127,6 +127,60 @@ TEST_P(InvertTest, verify)
   }
 }
 
+// Deflated solves with the eigenvectors stored block-compressed, which
+// needs the multigrid transfer operators and a 4-d fermion field
+class DeflatedCompressedInvertTest : public InvertTest
+{
+};
+
+TEST_P(DeflatedCompressedInvertTest, verify)
+{
+  if (skip_test(GetParam())) GTEST_SKIP();
+#ifndef GPU_MULTIGRID
+  GTEST_SKIP();
+#endif
+  if (is_chiral(dslash_type) || twist_flavor == QUDA_TWIST_NONDEG_DOUBLET) GTEST_SKIP();
+  // deflation cannot be combined with MG, and compression does not preserve the deflation space between solves
+  if (inv_multigrid || Nsrc > 1 || Nsrc_tile > 1) GTEST_SKIP();
+  if (grid_partition[0] * grid_partition[1] * grid_partition[2] * grid_partition[3] > 1) GTEST_SKIP();
+
+  auto tol = ::testing::get<0>(GetParam()) == QUDA_SINGLE_PRECISION ? 1e-6 : 1e-12;
+  inv_param.tol = tol;
+  inv_param.tol_hq = 0.0;
+
+  auto inv_deflate_save = inv_deflate;
+  auto eig_param_save = eig_param;
+  auto inv_eig_param_save = inv_param.eig_param;
+
+  // reference undeflated solve
+  inv_deflate = false;
+  inv_param.eig_param = nullptr;
+  solve(GetParam());
+  auto iter_undeflated = inv_param.iter;
+
+  inv_deflate = true;
+  setEigParam(eig_param);
+  // the basis size must be an instantiated multigrid Nvec
+  eig_param.compress_n_basis = eig_compress_n_basis > 0 ? eig_compress_n_basis : 6;
+  eig_param.preserve_deflation = QUDA_BOOLEAN_FALSE;
+  inv_param.eig_param = &eig_param;
+
+  auto res = solve(GetParam());
+  auto iter_deflated = inv_param.iter;
+  auto compress_bytes = eig_param.compress_bytes;
+  auto compress_full_bytes = eig_param.compress_full_bytes;
+
+  inv_deflate = inv_deflate_save;
+  eig_param = eig_param_save;
+  inv_param.eig_param = inv_eig_param_save;
+
+  for (auto rsd : res) EXPECT_LE(rsd[0], tol);
+  // the compressed deflation space must still remove the low modes, at a fraction of the storage
+  EXPECT_LT(iter_deflated, iter_undeflated);
+  EXPECT_GT(compress_bytes, 0.0);
+  EXPECT_LT(compress_bytes, compress_full_bytes);
+}
+
 std::string gettestname(::testing::TestParamInfo<test_t> param)
 {
   std::string name;
@@ -154,7 +208,8 @@ std::string gettestname(::testing::TestParamInfo<test_t> param)
 using ::testing::Combine;
 using ::testing::Values;
 auto normal_solvers
-  = Values(QUDA_CG_INVERTER, QUDA_CA_CG_INVERTER, QUDA_CG3_INVERTER, QUDA_PCG_INVERTER, QUDA_SD_INVERTER);
+  = Values(QUDA_CG_INVERTER, QUDA_CA_CG_INVERTER, QUDA_CG3_INVERTER, QUDA_PCG_INVERTER, QUDA_SD_INVERTER,
+           QUDA_PIPELINED_CG_INVERTER);
 
 auto direct_solvers = Values(QUDA_CGNE_INVERTER, QUDA_CGNR_INVERTER, QUDA_CA_CGNE_INVERTER, QUDA_CA_CGNR_INVERTER,
                              QUDA_CG3NE_INVERTER, QUDA_CG3NR_INVERTER, QUDA_GCR_INVERTER, QUDA_CA_GCR_INVERTER,
@@ -231,3 +286,10 @@ INSTANTIATE_TEST_SUITE_P(HeavyQuarkEvenOdd, InvertTest,
                                  Values(QUDA_NORMOP_PC_SOLVE), Values(1), solution_accumulator_pipelines, no_schwarz,
                                  Values(QUDA_L2_RELATIVE_RESIDUAL | QUDA_HEAVY_QUARK_RESIDUAL, QUDA_HEAVY_QUARK_RESIDUAL)),
                          gettestname);
+
+// deflated preconditioned normal solves with compressed eigenvectors
+INSTANTIATE_TEST_SUITE_P(DeflatedCompressed, DeflatedCompressedInvertTest,
+                         Combine(precisions, Values(QUDA_DOUBLE_PRECISION, QUDA_SINGLE_PRECISION),
+                                 Values(QUDA_CG_INVERTER), Values(QUDA_MATPCDAG_MATPC_SOLUTION),
+                                 Values(QUDA_NORMOP_PC_SOLVE), Values(1), Values(1), no_schwarz, no_heavy_quark),
+                         gettestname);
@@ -25,6 +25,7 @@ using namespace quda;
 std::vector<ColorSpinorField> xD, yD;
 
 std::shared_ptr<GaugeField> Y_d, X_d, Xinv_d, Yhat_d;
+std::shared_ptr<GaugeField> Y_h, X_h, Xinv_h, Yhat_h;
 
 int Ncolor;
 
@@ -116,6 +117,24 @@ void initFields(QudaPrecision prec)
     gaugeNoise(*X_d, rng, QUDA_NOISE_GAUSS);
     gaugeNoise(*Xinv_d, rng, QUDA_NOISE_GAUSS);
   }
+
+  // host copies of the links, so that the host operator needs no transfer to coarsen from
+  if (verify_results) {
+    auto host_copy = [](const GaugeField &u) {
+      GaugeFieldParam param(u);
+      param.location = QUDA_CPU_FIELD_LOCATION;
+      param.order = QUDA_QDP_GAUGE_ORDER;
+      param.create = QUDA_NULL_FIELD_CREATE;
+      param.pad = 0;
+      auto u_h = std::make_shared<GaugeField>(param);
+      u_h->copy(u);
+      return u_h;
+    };
+    Y_h = host_copy(*Y_d);
+    X_h = host_copy(*X_d);
+    Xinv_h = host_copy(*Xinv_d);
+    Yhat_h = host_copy(*Yhat_d);
+  }
 }
 
 void freeFields()
@@ -127,6 +146,37 @@ void freeFields()
   X_d.reset();
   Xinv_d.reset();
   Yhat_d.reset();
+
+  Y_h.reset();
+  X_h.reset();
+  Xinv_h.reset();
+  Yhat_h.reset();
+}
+
+/**
+   @return Tolerance on the relative L2 deviation between two
+   applications of the operator that differ only in the order of
+   accumulation, for links of precision prec
+*/
+double l2_tolerance(QudaPrecision prec)
+{
+  switch (prec) {
+  case QUDA_DOUBLE_PRECISION: return 1e-12;
+  case QUDA_SINGLE_PRECISION: return 2e-6;
+  default: return 4e-5;
+  }
+}
+
+/**
+   @return Tolerance on the maximum component deviation, as for l2_tolerance
+*/
+double max_tolerance(QudaPrecision prec)
+{
+  switch (prec) {
+  case QUDA_DOUBLE_PRECISION: return 1e-10;
+  case QUDA_SINGLE_PRECISION: return 1e-3;
+  default: return 4e-3;
+  }
 }
 
 DiracCoarse *dirac;
@@ -174,10 +224,87 @@ TEST(multi_rhs_test, verify)
     auto x2 = blas::norm2(x_ref);
     auto l2_dev = blas::xmyNorm(xD[i], x_ref);
 
-    // require that the relative L2 norm differs by no more than 2e-6/4e-5
-    EXPECT_LE(sqrt(l2_dev / x2), prec_sloppy == QUDA_SINGLE_PRECISION ? 2e-6 : 4e-5);
-    // require that each component differs by no more than 1e-3/4e-3
-    EXPECT_LE(max_dev[1], prec_sloppy == QUDA_SINGLE_PRECISION ? 1e-3 : 4e-3);
+    // require that the relative L2 norm and each component differ by no more than the precision allows
+    EXPECT_LE(sqrt(l2_dev / x2), l2_tolerance(prec_sloppy));
+    EXPECT_LE(max_dev[1], max_tolerance(prec_sloppy));
+  }
+}
+
+TEST(host_test, verify)
+{
+  if (prec < QUDA_SINGLE_PRECISION || prec_sloppy != prec
+      || (smoother_halo_prec != QUDA_INVALID_PRECISION && smoother_halo_prec != prec))
+    GTEST_SKIP() << "Host coarse operator requires uniform single or double precision";
+
+  printfQuda("\nTesting host coarse operator correctness...\n\n");
+
+  ColorSpinorParam param(yD[0]);
+  param.location = QUDA_CPU_FIELD_LOCATION;
+  param.fieldOrder = QUDA_SPACE_SPIN_COLOR_FIELD_ORDER;
+  param.create = QUDA_NULL_FIELD_CREATE;
+
+  std::vector<ColorSpinorField> xH, yH;
+  resize(xH, yD.size(), param);
+  resize(yH, yD.size(), param);
+  for (auto i = 0u; i < yD.size(); i++) yH[i].copy(yD[i]);
+
+  blas::zero(xD);
+  for (auto &x : xH) x.zero();
+
+  auto xEven = make_parity_subset(xD, QUDA_EVEN_PARITY);
+  auto yEven = make_parity_subset(yD, QUDA_EVEN_PARITY);
+  auto yOdd = make_parity_subset(yD, QUDA_ODD_PARITY);
+  auto xHEven = make_parity_subset(xH, QUDA_EVEN_PARITY);
+  auto yHEven = make_parity_subset(yH, QUDA_EVEN_PARITY);
+  auto yHOdd = make_parity_subset(yH, QUDA_ODD_PARITY);
+
+  switch (test_type) {
+  case 0:
+    dirac->Dslash(xEven, yOdd, QUDA_EVEN_PARITY);
+    dirac->Dslash(xHEven, yHOdd, QUDA_EVEN_PARITY);
+    break;
+  case 1:
+    dirac->M(xD, yD);
+    dirac->M(xH, yH);
+    break;
+  case 2:
+    dirac->Clover(xEven, yEven, QUDA_EVEN_PARITY);
+    dirac->Clover(xHEven, yHEven, QUDA_EVEN_PARITY);
+    break;
+  case 3:
+    dirac->Mdag(xD, yD);
+    dirac->Mdag(xH, yH);
+    break;
+  case 4:
+    dirac->MdagM(xD, yD);
+    dirac->MdagM(xH, yH);
+    break;
+  case 5:
+    dirac_pc->M(xEven, yOdd);
+    dirac_pc->M(xHEven, yHOdd);
+    break;
+  case 6:
+    dirac_pc->Mdag(xEven, yOdd);
+    dirac_pc->Mdag(xHEven, yHOdd);
+    break;
+  case 7:
+    dirac_pc->MdagM(xEven, yOdd);
+    dirac_pc->MdagM(xHEven, yHOdd);
+    break;
+  default: errorQuda("Undefined test %d", test_type);
+  }
+
+  ColorSpinorField x_ref(yD[0]);
+  for (auto i = 0u; i < xD.size(); i++) {
+    x_ref.copy(xH[i]);
+
+    auto max_dev = blas::max_deviation(xD[i], x_ref);
+    auto x2 = blas::norm2(x_ref);
+    auto l2_dev = blas::xmyNorm(xD[i], x_ref);
+
+    // the host and device operators differ only in the order of accumulation
+    EXPECT_LE(sqrt(l2_dev / x2), l2_tolerance(prec_sloppy));
+    EXPECT_LE(max_dev[1], max_tolerance(prec_sloppy));
   }
 }
 
@@ -267,8 +394,8 @@ int main(int argc, char **argv)
   param.setup_use_mma = mg_setup_use_mma[0];
   param.dslash_use_mma = mg_dslash_use_mma[0];
   param.matpcType = QUDA_MATPC_EVEN_EVEN;
-  dirac = new DiracCoarse(param, nullptr, nullptr, nullptr, nullptr, Y_d, X_d, Xinv_d, Yhat_d);
-  dirac_pc = new DiracCoarsePC(param, nullptr, nullptr, nullptr, nullptr, Y_d, X_d, Xinv_d, Yhat_d);
+  dirac = new DiracCoarse(param, Y_h, X_h, Xinv_h, Yhat_h, Y_d, X_d, Xinv_d, Yhat_d);
+  dirac_pc = new DiracCoarsePC(param, Y_h, X_h, Xinv_h, Yhat_h, Y_d, X_d, Xinv_d, Yhat_d);
 
   if (verify_results) {
     // Ensure gtest prints only from rank 0
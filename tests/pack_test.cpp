@@ -50,10 +50,18 @@ void init()
   param.anisotropy = 2.3;
   param.t_boundary = QUDA_ANTI_PERIODIC_T;
   param.gauge_fix = QUDA_GAUGE_FIXED_NO;
+  param.type = QUDA_WILSON_LINKS;
+  param.location = QUDA_CPU_FIELD_LOCATION;
 
-  // construct input fields
+  // construct input fields: a random gauge field in QDP order, and the same links site-major for CPS and MILC
   for (int dir = 0; dir < 4; dir++) { qdpCpuGauge_p[dir] = safe_malloc(V * gauge_site_size * param.cpu_prec); }
+  constructQudaGaugeField(qdpCpuGauge_p, 1, param.cpu_prec, &param);
   cpsCpuGauge_p = safe_malloc(4 * V * gauge_site_size * param.cpu_prec);
+  size_t link_bytes = gauge_site_size * param.cpu_prec;
+  for (int i = 0; i < V; i++)
+    for (int dir = 0; dir < 4; dir++)
+      memcpy(static_cast<char *>(cpsCpuGauge_p) + (4 * i + dir) * link_bytes,
+             static_cast<char *>(qdpCpuGauge_p[dir]) + i * link_bytes, link_bytes);
 
   csParam.nColor = 3;
   csParam.nSpin = 4;
@@ -97,9 +105,88 @@ void end()
   endQuda();
 }
 
-void packTest()
+/**
+   @return The largest difference between the links of two gauge
+   fields, compared on the host in double precision QDP order
+*/
+double maxLinkDeviation(const GaugeField &a, const GaugeField &b)
+{
+  GaugeFieldParam host_param(a);
+  host_param.location = QUDA_CPU_FIELD_LOCATION;
+  host_param.order = QUDA_QDP_GAUGE_ORDER;
+  host_param.reconstruct = QUDA_RECONSTRUCT_NO;
+  host_param.ghostExchange = QUDA_GHOST_EXCHANGE_NO;
+  host_param.pad = 0;
+  host_param.create = QUDA_NULL_FIELD_CREATE;
+  host_param.setPrecision(QUDA_DOUBLE_PRECISION);
+  GaugeField a_host(host_param);
+  GaugeField b_host(host_param);
+  a_host.copy(a);
+  b_host.copy(b);
+
+  double deviation = 0.0;
+  for (int d = 0; d < 4; d++) {
+    auto a_d = a_host.data<double *>(d);
+    auto b_d = b_host.data<double *>(d);
+    for (size_t i = 0; i < a_host.Volume() * gauge_site_size; i++)
+      deviation = std::max(deviation, std::abs(a_d[i] - b_d[i]));
+  }
+  return deviation;
+}
+
+/**
+   Benchmark the host reordering between an application gauge order
+   and the native device order, as used by loadGaugeQuda and
+   saveGaugeQuda when QUDA_REORDER_LOCATION=CPU, and report the
+   achieved bandwidth.  Both directions are checked against
+   cudaGauge, which must hold the links of cpuGauge as reordered by
+   GaugeField::copy.
+   @return The number of directions that failed the check
+*/
+int reorderBenchmark(const char *name, GaugeField &cpuGauge, GaugeField &cudaGauge)
+{
+  std::vector<char> buffer(cudaGauge.Bytes());
+  double bytes = static_cast<double>(cpuGauge.Bytes() + cudaGauge.Bytes());
+  double tol = cudaGauge.Precision() == QUDA_DOUBLE_PRECISION ? 1e-12 : 1e-5;
+  int failures = 0;
+  host_timer_t host_timer;
+
+  // the first call of each direction tunes the host launch
+  copyGenericGauge(cudaGauge, cpuGauge, QUDA_CPU_FIELD_LOCATION, buffer.data(), nullptr);
+  host_timer.start();
+  for (int i = 0; i < niter; i++)
+    copyGenericGauge(cudaGauge, cpuGauge, QUDA_CPU_FIELD_LOCATION, buffer.data(), nullptr);
+  host_timer.stop();
+  printfQuda("%s Gauge host reorder to native: %e seconds, %.2f GB/s\n", name, host_timer.last() / niter,
+             1e-9 * bytes * niter / host_timer.last());
+
+  GaugeFieldParam native_param(cudaGauge);
+  native_param.create = QUDA_NULL_FIELD_CREATE;
+  GaugeField native(native_param);
+  qudaMemcpy(native.data(), buffer.data(), native.Bytes(), qudaMemcpyHostToDevice);
+  double deviation = maxLinkDeviation(native, cudaGauge);
+  printfQuda("%s Gauge host reorder to native: max deviation = %e\n", name, deviation);
+  if (!(deviation <= tol)) failures++;
+
+  copyGenericGauge(cpuGauge, cudaGauge, QUDA_CPU_FIELD_LOCATION, nullptr, buffer.data());
+  host_timer.start();
+  for (int i = 0; i < niter; i++)
+    copyGenericGauge(cpuGauge, cudaGauge, QUDA_CPU_FIELD_LOCATION, nullptr, buffer.data());
+  host_timer.stop();
+  printfQuda("%s Gauge host reorder from native: %e seconds, %.2f GB/s\n", name, host_timer.last() / niter,
+             1e-9 * bytes * niter / host_timer.last());
+
+  deviation = maxLinkDeviation(cpuGauge, cudaGauge);
+  printfQuda("%s Gauge host reorder from native: max deviation = %e\n", name, deviation);
+  if (!(deviation <= tol)) failures++;
+
+  return failures;
+}
+
+int packTest()
 {
   host_timer_t host_timer;
+  int failures = 0;
 
   printfQuda("Sending fields to GPU...\n");
 
@@ -113,6 +200,7 @@ void packTest()
     cpsParam.reconstruct = param.reconstruct;
     cpsParam.setPrecision(param.cuda_prec, true);
     cpsParam.pad = param.ga_pad;
+    cpsParam.location = QUDA_CUDA_FIELD_LOCATION;
     GaugeField cudaCpsGauge(cpsParam);
 
     host_timer.start();
@@ -124,6 +212,35 @@ void packTest()
     cpsCpuGauge.copy(cudaCpsGauge);
     host_timer.stop();
     printfQuda("CPS Gauge restore time = %e seconds\n", host_timer.last());
+
+    failures += reorderBenchmark("CPS", cpsCpuGauge, cudaCpsGauge);
+  }
+#endif
+
+#ifdef BUILD_MILC_INTERFACE
+  {
+    param.gauge_order = QUDA_MILC_GAUGE_ORDER;
+
+    GaugeFieldParam milcParam(param, cpsCpuGauge_p);
+    GaugeField milcCpuGauge(milcParam);
+    milcParam.create = QUDA_NULL_FIELD_CREATE;
+    milcParam.reconstruct = param.reconstruct;
+    milcParam.setPrecision(param.cuda_prec, true);
+    milcParam.pad = param.ga_pad;
+    milcParam.location = QUDA_CUDA_FIELD_LOCATION;
+    GaugeField cudaMilcGauge(milcParam);
+
+    host_timer.start();
+    cudaMilcGauge.copy(milcCpuGauge);
+    host_timer.stop();
+    printfQuda("MILC Gauge send time = %e seconds\n", host_timer.last());
+
+    host_timer.start();
+    milcCpuGauge.copy(cudaMilcGauge);
+    host_timer.stop();
+    printfQuda("MILC Gauge restore time = %e seconds\n", host_timer.last());
+
+    failures += reorderBenchmark("MILC", milcCpuGauge, cudaMilcGauge);
   }
 #endif
 
@@ -137,6 +254,7 @@ void packTest()
     qdpParam.reconstruct = param.reconstruct;
     qdpParam.setPrecision(param.cuda_prec, true);
     qdpParam.pad = param.ga_pad;
+    qdpParam.location = QUDA_CUDA_FIELD_LOCATION;
     GaugeField cudaQdpGauge(qdpParam);
 
     host_timer.start();
@@ -148,6 +266,8 @@ void packTest()
     qdpCpuGauge.copy(cudaQdpGauge);
     host_timer.stop();
     printfQuda("QDP Gauge restore time = %e seconds\n", host_timer.last());
+
+    failures += reorderBenchmark("QDP", qdpCpuGauge, cudaQdpGauge);
   }
 #endif
 
@@ -168,6 +288,9 @@ void packTest()
   printfQuda("Norm check: CPU = %e, CUDA = %e, CPU = %e\n", spinor_norm, cuda_spinor_norm, spinor2_norm);
 
   ColorSpinorField::Compare(*spinor, *spinor2, 1);
+
+  if (failures > 0) printfQuda("%d gauge reorder checks failed\n", failures);
+  return failures;
 }
 
 int main(int argc, char **argv)
@@ -183,8 +306,9 @@ int main(int argc, char **argv)
   initComms(argc, argv, gridsize_from_cmdline);
 
   init();
-  packTest();
+  int result = packTest();
   end();
 
   finalizeComms();
+  return result;
 }
@@ -0,0 +1,224 @@
+#include <cmath>
+#include <cstring>
+#include <vector>
+#include <comm_quda.h>
+#include <color_spinor_field.h>
+#include <random_quda.h>
+#include <targets/generic/philox.h>
+#include <test.h>
+
+/*
+   This test checks the generators that back RNG using spinor noise.
+   For both the stateful and the counter-based generator, the noise
+   must have the expected moments, and neither autotuning nor
+   backup/restore may change the numbers drawn.  The counter-based
+   noise is also compared site by site with a host Philox4x32-10
+   reference indexed by global coordinates, which checks the
+   curand/hiprand conventions against the constexpr generator (itself
+   checked against the Random123 known answers), and that the noise
+   does not depend on the process decomposition.
+ */
+
+using namespace quda;
+
+using test_t = ::testing::tuple<RNGType, QudaPrecision, QudaNoiseType>;
+
+ColorSpinorParam host_param(int t_extra = 0)
+{
+  ColorSpinorParam param;
+  param.nColor = 3;
+  param.nSpin = 4;
+  param.nDim = 4;
+  param.x = {xdim, ydim, zdim, tdim + t_extra};
+  param.siteSubset = QUDA_FULL_SITE_SUBSET;
+  param.siteOrder = QUDA_EVEN_ODD_SITE_ORDER;
+  param.gammaBasis = QUDA_DEGRAND_ROSSI_GAMMA_BASIS;
+  param.setPrecision(QUDA_DOUBLE_PRECISION);
+  param.fieldOrder = QUDA_SPACE_SPIN_COLOR_FIELD_ORDER;
+  param.create = QUDA_ZERO_FIELD_CREATE;
+  param.pc_type = QUDA_4D_PC;
+  param.location = QUDA_CPU_FIELD_LOCATION;
+  return param;
+}
+
+/**
+   @brief Generate noise on the device at the given precision and
+   return it in a double-precision host field
+ */
+ColorSpinorField noise(RNG &rng, const ColorSpinorField &meta, QudaPrecision prec, QudaNoiseType type)
+{
+  ColorSpinorParam param(meta);
+  param.create = QUDA_ZERO_FIELD_CREATE;
+  ColorSpinorField host(param);
+  param.setPrecision(prec, prec, true);
+  param.location = QUDA_CUDA_FIELD_LOCATION;
+  param.create = QUDA_NULL_FIELD_CREATE;
+  ColorSpinorField device(param);
+  spinorNoise(device, rng, type);
+  host = device;
+  return host;
+}
+
+bool identical(const ColorSpinorField &a, const ColorSpinorField &b)
+{
+  return memcmp(a.data(), b.data(), a.Bytes()) == 0;
+}
+
+class RNGTest : public ::testing::TestWithParam<test_t>
+{
+protected:
+  RNGType rng_type;
+  QudaPrecision prec;
+  QudaNoiseType noise_type;
+  ColorSpinorField meta;
+
+public:
+  RNGTest() :
+    rng_type(::testing::get<0>(GetParam())),
+    prec(::testing::get<1>(GetParam())),
+    noise_type(::testing::get<2>(GetParam())),
+    meta(host_param())
+  {
+  }
+};
+
+TEST_P(RNGTest, moments)
+{
+  RNG rng(meta, 1234, rng_type);
+  auto v = noise(rng, meta, prec, noise_type);
+
+  // sums of the real and imaginary parts and of their squares, and the sample count
+  std::vector<double> sum(5, 0.0);
+  auto data = v.data<const double *>();
+  const size_t n = v.Volume() * v.Nspin() * v.Ncolor();
+  for (size_t i = 0; i < n; i++) {
+    for (int j = 0; j < 2; j++) {
+      sum[j] += data[2 * i + j];
+      sum[2 + j] += data[2 * i + j] * data[2 * i + j];
+    }
+  }
+  sum[4] = n;
+  comm_allreduce_sum(sum);
+
+  // uniform components are U(0,1), Gaussian components are N(0,1/2)
+  const bool uniform = noise_type == QUDA_NOISE_UNIFORM;
+  const double mean = uniform ? 0.5 : 0.0;
+  const double var = uniform ? 1.0 / 12.0 : 0.5;
+  const double mu4 = uniform ? 1.0 / 80.0 : 0.75; // fourth central moment
+  const double N = sum[4];
+
+  for (int j = 0; j < 2; j++) {
+    double m = sum[j] / N;
+    double s2 = sum[2 + j] / N - m * m;
+    EXPECT_NEAR(m, mean, 5 * std::sqrt(var / N)) << (j == 0 ? "real" : "imaginary") << " mean";
+    EXPECT_NEAR(s2, var, 5 * std::sqrt((mu4 - var * var) / N)) << (j == 0 ? "real" : "imaginary") << " variance";
+  }
+}
+
+TEST_P(RNGTest, tuning)
+{
+  // The lattice is changed, differently for each generator, so that
+  // without a tunecache the first launch autotunes, with the generator
+  // backed up and restored around the trial launches, while the second
+  // uses the cached launch parameters.  Both must draw the same numbers.
+  ColorSpinorField meta_t(host_param(rng_type == RNGType::COUNTER ? 4 : 2));
+  RNG rng_tune(meta_t, 5678, rng_type);
+  auto tuned = noise(rng_tune, meta_t, prec, noise_type);
+
+  RNG rng_cached(meta_t, 5678, rng_type);
+  auto cached = noise(rng_cached, meta_t, prec, noise_type);
+
+  EXPECT_TRUE(identical(tuned, cached));
+}
+
+TEST_P(RNGTest, restore)
+{
+  RNG ref(meta, 91011, rng_type);
+  auto a0 = noise(ref, meta, prec, noise_type);
+  auto a1 = noise(ref, meta, prec, noise_type);
+  EXPECT_FALSE(identical(a0, a1)) << "successive draws are identical";
+
+  // draws between backup and restore are discarded, and the stream resumes where it was
+  RNG rng(meta, 91011, rng_type);
+  rng.backup();
+  noise(rng, meta, prec, noise_type);
+  noise(rng, meta, prec, noise_type);
+  rng.restore();
+  auto b0 = noise(rng, meta, prec, noise_type);
+  auto b1 = noise(rng, meta, prec, noise_type);
+
+  EXPECT_TRUE(identical(a0, b0));
+  EXPECT_TRUE(identical(a1, b1));
+}
+
+TEST_P(RNGTest, known_answer)
+{
+  // the float conversion takes a single 32-bit output on every target, while
+  // the double conversion of curand and hiprand consumes two
+  if (rng_type != RNGType::COUNTER || prec != QUDA_SINGLE_PRECISION || noise_type != QUDA_NOISE_UNIFORM)
+    GTEST_SKIP();
+
+  const unsigned long long seed = 121314;
+  RNG rng(meta, seed, rng_type);
+
+  int X[4], X_global[4];
+  for (int d = 0; d < 4; d++) {
+    X[d] = meta.X(d);
+    X_global[d] = X[d] * comm_dim(d);
+  }
+
+  // each launch advances the stream counter, which reserves 2^32 outputs per site
+  for (unsigned long long counter = 0; counter < 2; counter++) {
+    auto v = noise(rng, meta, prec, noise_type);
+    auto data = v.data<const double *>();
+
+    size_t mismatch = 0;
+    for (int parity = 0; parity < 2; parity++) {
+      for (size_t x_cb = 0; x_cb < v.VolumeCB(); x_cb++) {
+        int x[4];
+        int za = x_cb / (X[0] / 2);
+        int x0h = x_cb - za * (X[0] / 2);
+        int zb = za / X[1];
+        x[1] = za - zb * X[1];
+        x[3] = zb / X[2];
+        x[2] = zb - x[3] * X[2];
+        x[0] = 2 * x0h + ((x[1] + x[2] + x[3] + parity) & 1);
+
+        unsigned long long sequence = x[3] + comm_coord(3) * X[3];
+        for (int d = 2; d >= 0; d--) sequence = sequence * X_global[d] + x[d] + comm_coord(d) * X[d];
+
+        target::rng::Philox4x32 prn;
+        target::rng::seed(prn, seed, sequence, counter << 32);
+        for (int i = 0; i < v.Nspin() * v.Ncolor() * 2; i++) {
+          double ref = target::rng::uniform(prn);
+          double u = data[(parity * v.VolumeCB() + x_cb) * v.Nspin() * v.Ncolor() * 2 + i];
+          if (std::fabs(u - ref) > std::ldexp(1.0, -23)) mismatch++;
+        }
+      }
+    }
+    comm_allreduce_sum(mismatch);
+    EXPECT_EQ(mismatch, size_t(0)) << "stream counter " << counter;
+  }
+}
+
+std::string gettestname(::testing::TestParamInfo<test_t> param)
+{
+  std::string name;
+  name += ::testing::get<0>(param.param) == RNGType::COUNTER ? "counter_" : "stateful_";
+  name += get_prec_str(::testing::get<1>(param.param)) + std::string("_");
+  name += ::testing::get<2>(param.param) == QUDA_NOISE_UNIFORM ? "uniform" : "gauss";
+  return name;
+}
+
+INSTANTIATE_TEST_SUITE_P(RandomTest, RNGTest,
+                         ::testing::Combine(::testing::Values(RNGType::STATEFUL, RNGType::COUNTER),
+                                            ::testing::Values(QUDA_DOUBLE_PRECISION, QUDA_SINGLE_PRECISION),
+                                            ::testing::Values(QUDA_NOISE_UNIFORM, QUDA_NOISE_GAUSS)),
+                         gettestname);
+
+int main(int argc, char **argv)
+{
+  quda_test test("random_test", argc, argv);
+  test.init();
+  return test.execute();
+}
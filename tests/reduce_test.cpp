@@ -0,0 +1,182 @@
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <vector>
+#include <communicator_quda.h>
+#include <test.h>
+
+/*
+   This test checks the binned summation used by the deterministic
+   reduction (QUDA_DETERMINISTIC_REDUCE=1).  A fixed set of partials
+   is combined in many orders and groupings, emulating different rank
+   counts and reduction trees, and the result must be bitwise
+   identical each time and agree with a high-precision reference.  When
+   the deterministic reduction is enabled, the allreduce over the
+   actual ranks must reproduce the same bits.
+ */
+
+using namespace quda;
+
+using bins_t = std::array<double, binned_folds>;
+
+/**
+   @brief Partials spanning many orders of magnitude and of both
+   signs, so that a naive sum depends on the order of summation
+ */
+std::vector<double> make_partials(size_t n, unsigned seed)
+{
+  std::mt19937_64 rng(seed);
+  std::uniform_real_distribution<double> mantissa(-1.0, 1.0);
+  std::uniform_int_distribution<int> exponent(-30, 30);
+  std::vector<double> x(n);
+  for (auto &v : x) v = std::ldexp(mantissa(rng), exponent(rng));
+  return x;
+}
+
+double max_magnitude(const std::vector<double> &x)
+{
+  double max = 0.0;
+  for (auto v : x) max = std::max(max, std::fabs(v));
+  return max;
+}
+
+/**
+   @brief Binned sum of the partials, shuffled and dealt out to
+   n_ranks groups.  Each group accumulates its components locally,
+   emulating a subtree of the allreduce, and the group totals are then
+   combined in a shuffled order.
+ */
+double binned_reduce(std::vector<double> x, double max, size_t n_ranks, std::mt19937_64 &rng)
+{
+  std::shuffle(x.begin(), x.end(), rng);
+
+  std::vector<bins_t> group(n_ranks, bins_t {});
+  for (size_t i = 0; i < x.size(); i++) {
+    bins_t bins;
+    binned_split(bins.data(), &x[i], &max, 1);
+    for (int k = 0; k < binned_folds; k++) group[i % n_ranks][k] += bins[k];
+  }
+
+  std::shuffle(group.begin(), group.end(), rng);
+  bins_t total = {};
+  for (auto &g : group)
+    for (int k = 0; k < binned_folds; k++) total[k] += g[k];
+  return binned_sum(total.data());
+}
+
+/**
+   @brief Correctly rounded sum, accumulated as an expansion of
+   non-overlapping partials (Shewchuk's algorithm, as in Python's fsum)
+ */
+double exact_sum(const std::vector<double> &x)
+{
+  std::vector<double> partials;
+  for (double v : x) {
+    size_t n = 0;
+    for (double p : partials) {
+      if (std::fabs(v) < std::fabs(p)) std::swap(v, p);
+      double hi = v + p;
+      double lo = p - (hi - v);
+      if (lo != 0.0) partials[n++] = lo;
+      v = hi;
+    }
+    partials.resize(n);
+    partials.push_back(v);
+  }
+
+  // round the expansion, largest first, correcting for a half-way tie
+  double hi = 0.0;
+  double lo = 0.0;
+  int n = partials.size();
+  if (n > 0) {
+    hi = partials[--n];
+    while (n > 0) {
+      double v = hi;
+      double p = partials[--n];
+      hi = v + p;
+      lo = p - (hi - v);
+      if (lo != 0.0) break;
+    }
+    if (n > 0 && ((lo < 0.0 && partials[n - 1] < 0.0) || (lo > 0.0 && partials[n - 1] > 0.0))) {
+      double v = lo * 2.0;
+      double h = hi + v;
+      if (v == h - hi) hi = h;
+    }
+  }
+  return hi;
+}
+
+using test_t = ::testing::tuple<int>;
+
+struct BinnedReduceTest : ::testing::TestWithParam<test_t> {
+};
+
+TEST_P(BinnedReduceTest, reproducible)
+{
+  const size_t n = ::testing::get<0>(GetParam());
+  const auto x = make_partials(n, 1234 + n);
+  const double max = max_magnitude(x);
+
+  std::mt19937_64 rng(5678);
+  const double ref = binned_reduce(x, max, 1, rng);
+
+  for (size_t n_ranks : std::vector<size_t> {1, 2, 3, 4, 7, 16, 64, n}) {
+    for (int order = 0; order < 4; order++) {
+      double sum = binned_reduce(x, max, n_ranks, rng);
+      EXPECT_EQ(memcmp(&sum, &ref, sizeof(double)), 0)
+        << "ranks = " << n_ranks << " order = " << order << " sum = " << sum << " reference = " << ref;
+    }
+  }
+
+  // the components are exact to well beyond double precision relative
+  // to the maximum, so only the final recombination rounds
+  const double exact = std::fabs(exact_sum(x));
+  int e;
+  std::frexp(max, &e);
+  const double ulp = std::nextafter(exact, std::numeric_limits<double>::infinity()) - exact;
+  const double tol = 2 * ulp + n * std::ldexp(1.0, e - 90);
+  EXPECT_LE(std::fabs(std::fabs(ref) - exact), tol);
+}
+
+TEST_P(BinnedReduceTest, allreduce)
+{
+  if (!comm_deterministic_reduce()) GTEST_SKIP() << "Set QUDA_DETERMINISTIC_REDUCE=1 to check the allreduce";
+  if (comm_size() == 1) GTEST_SKIP() << "Nothing to reduce on a single rank";
+
+  // every rank holds the same partials, and each contributes its own share
+  const size_t n = ::testing::get<0>(GetParam());
+  const auto x = make_partials(n * comm_size(), 4321 + n);
+
+  std::vector<double> expect(n);
+  std::mt19937_64 rng(8765);
+  for (size_t i = 0; i < n; i++) {
+    std::vector<double> xi(comm_size());
+    for (int r = 0; r < comm_size(); r++) xi[r] = x[r * n + i];
+    expect[i] = binned_reduce(xi, max_magnitude(xi), comm_size(), rng);
+  }
+
+  std::vector<double> local(x.begin() + comm_rank() * n, x.begin() + (comm_rank() + 1) * n);
+  comm_allreduce_sum(local);
+  EXPECT_EQ(memcmp(local.data(), expect.data(), n * sizeof(double)), 0);
+
+  // the non-blocking reduction must agree too
+  std::vector<double> async(x.begin() + comm_rank() * n, x.begin() + (comm_rank() + 1) * n);
+  auto rh = comm_allreduce_sum_array_start(async.data(), n);
+  comm_allreduce_wait(rh);
+  EXPECT_EQ(memcmp(async.data(), expect.data(), n * sizeof(double)), 0);
+}
+
+INSTANTIATE_TEST_SUITE_P(ReduceTest, BinnedReduceTest, ::testing::Values(1, 17, 256, 4096),
+                         [](::testing::TestParamInfo<test_t> param) {
+                           return std::string("n") + std::to_string(::testing::get<0>(param.param));
+                         });
+
+int main(int argc, char **argv)
+{
+  quda_test test("reduce_test", argc, argv);
+  test.init();
+  return test.execute();
+}
@@ -245,6 +245,11 @@ std::string eig_vec_outfile;
 bool eig_io_parity_inflate = false;
 QudaPrecision eig_save_prec = QUDA_DOUBLE_PRECISION;
 bool eig_partfile = false;
+std::array<int, 4> eig_compress_block_size = {4, 4, 4, 4};
+int eig_compress_n_basis = 0;
+QudaPrecision eig_compress_prec = QUDA_HALF_PRECISION;
+std::string eig_checkpoint_file;
+int eig_checkpoint_interval = 1;
 
 // Parameters for the MG eigensolver.
 // The coarsest grid params are for deflation,
@@ -388,7 +393,8 @@ namespace
                                                            {"ca-cg", QUDA_CA_CG_INVERTER},
                                                            {"ca-cgne", QUDA_CA_CGNE_INVERTER},
                                                            {"ca-cgnr", QUDA_CA_CGNR_INVERTER},
-                                                           {"ca-gcr", QUDA_CA_GCR_INVERTER}};
+                                                           {"ca-gcr", QUDA_CA_GCR_INVERTER},
+                                                           {"pipelined-cg", QUDA_PIPELINED_CG_INVERTER}};
 
   CLI::TransformPairs<QudaPrecision> precision_map {{"double", QUDA_DOUBLE_PRECISION},
                                                     {"single", QUDA_SINGLE_PRECISION},
@@ -820,6 +826,21 @@ void add_eigen_option_group(std::shared_ptr<QUDAApp> quda_app)
     "--eig-io-parity-inflate", eig_io_parity_inflate,
     "Whether to inflate single-parity eigenvectors onto dual parity full fields for file I/O (default = false)");
 
+  opgroup
+    ->add_option("--eig-compress-block-size", eig_compress_block_size,
+                 "Geometric block size used to compress the eigenvectors (default 4 4 4 4)")
+    ->expected(4);
+  opgroup->add_option("--eig-compress-n-basis", eig_compress_n_basis,
+                      "Number of eigenvectors used as the compression block basis (default 0 = no compression)");
+  opgroup
+    ->add_option("--eig-compress-prec", eig_compress_prec,
+                 "Precision with which to store the compressed eigenvectors (default half)")
+    ->transform(prec_transform);
+  opgroup->add_option("--eig-checkpoint-file", eig_checkpoint_file,
+                      "Checkpoint the eigensolver state to <file>, resuming from it if present (requires QIO)");
+  opgroup->add_option("--eig-checkpoint-interval", eig_checkpoint_interval,
+                      "Number of restarts between eigensolver checkpoints (default 1)");
+
   opgroup
     ->add_option("--eig-spectrum", eig_spectrum,
                  "The spectrum part to be calulated. S=smallest L=largest R=real M=modulus I=imaginary")
@@ -494,6 +494,11 @@ extern std::string eig_vec_outfile;
 extern bool eig_io_parity_inflate;
 extern QudaPrecision eig_save_prec;
 extern bool eig_partfile;
+extern std::array<int, 4> eig_compress_block_size;
+extern int eig_compress_n_basis;
+extern QudaPrecision eig_compress_prec;
+extern std::string eig_checkpoint_file;
+extern int eig_checkpoint_interval;
 
 // Parameters for the MG eigensolver.
 // The coarsest grid params are for deflation,
@@ -373,6 +373,13 @@ void setEigParam(QudaEigParam &eig_param)
   eig_param.io_parity_inflate = eig_io_parity_inflate ? QUDA_BOOLEAN_TRUE : QUDA_BOOLEAN_FALSE;
   eig_param.partfile = eig_partfile ? QUDA_BOOLEAN_TRUE : QUDA_BOOLEAN_FALSE;
 
+  for (int i = 0; i < 4; i++) eig_param.compress_block_size[i] = eig_compress_block_size[i];
+  eig_param.compress_n_basis = eig_compress_n_basis;
+  eig_param.compress_precision = eig_compress_prec;
+
+  safe_strcpy(eig_param.checkpoint_file, eig_checkpoint_file, 256, "eig_checkpoint_file");
+  eig_param.checkpoint_interval = eig_checkpoint_interval;
+
   eig_param.struct_size = sizeof(eig_param);
 }
 
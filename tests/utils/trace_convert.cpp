@@ -0,0 +1,55 @@
+#include <algorithm>
+#include <array>
+#include <cstdio>
+#include <cstdlib>
+#include <limits>
+#include <string>
+
+#include <tune_quda.h>
+#include <host_utils.h>
+
+/*
+   Convert the binary trace streams written with QUDA_ENABLE_TRACE set
+   (one [<base>_]trace_rank<r>.bin per rank) to Chrome/Perfetto trace
+   event json.  Each output file is named after its input, with the
+   .bin replaced by .json.  The events are given the rank in the file
+   name as their pid, unless an explicit pid is given with -p.  The
+   event times of all the inputs are given relative to the earliest
+   wall-clock base among them, so that the ranks are aligned.
+
+   usage: trace_convert [-p pid] trace_rank0.bin [trace_rank1.bin ...]
+ */
+
+int main(int argc, char **argv)
+{
+  int pid = -1;
+  int first = 1;
+  if (argc > 2 && std::string(argv[1]) == "-p") {
+    pid = atoi(argv[2]);
+    first = 3;
+  }
+  if (first >= argc) {
+    printf("usage: %s [-p pid] trace_rank0.bin [trace_rank1.bin ...]\n", argv[0]);
+    return 1;
+  }
+
+  // the communicator is only needed for error reporting
+  std::array<int, 4> comm_dims = {1, 1, 1, 1};
+  initComms(1, argv, comm_dims);
+
+  int64_t origin = std::numeric_limits<int64_t>::max();
+  for (int i = first; i < argc; i++) origin = std::min(origin, quda::traceStreamBase(argv[i]));
+
+  for (int i = first; i < argc; i++) {
+    std::string trace_path = argv[i];
+    auto dot = trace_path.rfind(".bin");
+    std::string json_path = (dot == std::string::npos ? trace_path : trace_path.substr(0, dot)) + ".json";
+    printf("Converting %s to %s\n", trace_path.c_str(), json_path.c_str());
+    auto rank = trace_path.rfind("trace_rank");
+    int file_pid = rank == std::string::npos ? 0 : atoi(trace_path.c_str() + rank + 10);
+    quda::convertTraceToChrome(trace_path, json_path, pid >= 0 ? pid : file_pid, origin);
+  }
+
+  finalizeComms();
+  return 0;
+}